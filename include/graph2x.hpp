@@ -7,6 +7,7 @@
 #include "graph2x/algo/algo.hpp"
 #include "graph2x/graphs/graphs.hpp"
 #include "graph2x/graph_gen/graph_gen.hpp"
+#include "graph2x/io/io.hpp"
 
 
 #endif //GRAPH2X_GRAPH2X_HPP_F28D1E1186DE47298F5FDE26C930CB85
@@ -3,7 +3,11 @@
 #define GRAPH2X_ALGO_HPP_4D6D6EC46344481085E2294A07606737
 
 #include "bip_matchings.hpp"
+#include "incremental_matching.hpp"
 #include "matching_reductions.hpp"
 #include "search.hpp"
+#include "dense_bfs.hpp"
+#include "direction_optimizing_bfs.hpp"
+#include "parallel_bfs.hpp"
 
 #endif //GRAPH2X_ALGO_HPP_4D6D6EC46344481085E2294A07606737
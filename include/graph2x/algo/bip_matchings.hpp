@@ -8,12 +8,19 @@
 #include <set>
 #include <algorithm>
 #include <functional>
+#include <queue>
 
 #include <math.h>
+#include <numeric>
 #include <random>
+#include <atomic>
+#include <barrier>
+#include <deque>
+#include <span>
 
 #include "search.hpp"
 #include "../core.hpp"
+#include "../execution.hpp"
 
 namespace g2x {
 	
@@ -47,49 +54,75 @@ namespace g2x {
 			return result_type{labels};
 		}
 
-		template<typename GraphRefT>
-			requires graph<std::remove_cvref_t<GraphRefT>>
-		auto find_bipartite_augmenting_path(
-			GraphRefT&& graph,
-			edge_property_of<GraphRefT, char> auto&& partitions,
-			edge_property_of<GraphRefT, bool> auto&& matching
-		) -> std::vector<edge_id_t<GraphRefT>>
-		{
-			auto edge_predicate = [&](auto&& edge) {
-				const auto& [u, v, i] = edge;
-				if(matching[i]) {
-					return partitions[u] == 1 && partitions[v] == 0;
-				} else {
-					return partitions[u] == 0 && partitions[v] == 1;
-				}
-			};
+		namespace detail {
+
+			/*
+			 * Breadth-first search along alternating paths that start at the free left vertices:
+			 * unmatched edges are followed from left to right and matched ones from right to left.
+			 * Calls on_reached(bfs, v, is_free) for every reached vertex and stops early
+			 * when it returns true.
+			 */
+			template<typename GraphRefT>
+				requires graph<std::remove_cvref_t<GraphRefT>>
+			void alternating_search_from_free_left(
+				GraphRefT&& graph,
+				auto&& partitions,
+				auto&& matching,
+				auto&& on_reached
+			) {
+				auto edge_predicate = [&](auto&& edge) {
+					const auto& [u, v, i] = edge;
+					if(matching[i]) {
+						return partitions[u] == 1 && partitions[v] == 0;
+					} else {
+						return partitions[u] == 0 && partitions[v] == 1;
+					}
+				};
 
-			breadth_first_search bfs {graph, edge_predicate};
+				breadth_first_search bfs {graph, edge_predicate};
 
-			auto vtx_matched = create_vertex_property(graph, char(false));
+				auto vtx_matched = create_vertex_property(graph, char(false));
 
-			for(const auto& [u, v, i]: all_edges(graph)) {
-				if(matching[i]) {
-					vtx_matched[u] = true;
-					vtx_matched[v] = true;
+				for(const auto& [u, v, i]: all_edges(graph)) {
+					if(matching[i]) {
+						vtx_matched[u] = true;
+						vtx_matched[v] = true;
+					}
 				}
-			}
 
-			for(const auto& v: all_vertices(graph)) {
-				if(not vtx_matched[v] && partitions[v] == 0) {
-					bfs.add_vertex(v);
+				for(const auto& v: all_vertices(graph)) {
+					if(not vtx_matched[v] && partitions[v] == 0) {
+						bfs.add_vertex(v);
+					}
+				}
+
+				while(auto v_opt = bfs.next_vertex()) {
+					auto v = *v_opt;
+					if(on_reached(bfs, v, not vtx_matched[v])) {
+						return;
+					}
 				}
 			}
 
-			while(auto v_opt = bfs.next_vertex()) {
-				auto v = *v_opt;
-				if(not vtx_matched[v] && partitions[v] == 1) { //augmenting path found - trace to source
-					std::vector<edge_id_t<GraphRefT>> result;
+		}
+
+		template<typename GraphRefT>
+			requires graph<std::remove_cvref_t<GraphRefT>>
+		auto find_bipartite_augmenting_path(
+			GraphRefT&& graph,
+			edge_property_of<GraphRefT, char> auto&& partitions,
+			edge_property_of<GraphRefT, bool> auto&& matching
+		) -> std::vector<edge_id_t<GraphRefT>>
+		{
+			std::vector<edge_id_t<GraphRefT>> result;
+			detail::alternating_search_from_free_left(graph, partitions, matching, [&](auto& bfs, const auto& v, bool is_free) {
+				if(is_free && partitions[v] == 1) { //augmenting path found - trace to source
 					bfs.trace_path(v, std::back_inserter(result));
-					return result;
+					return true;
 				}
-			}
-			return {};
+				return false;
+			});
+			return result;
 		}
 
 
@@ -256,234 +289,958 @@ namespace g2x {
 				return lookup_table[idx];
 			}
 
-			bool hopcroft_karp_dfs_step(
-				graph auto&& graph,
-				edge_property_of<decltype(graph), bool> auto&& matching,
-				vertex_property_of<decltype(graph), int> auto&& bfs_levels,
-				vertex_property_of<decltype(graph), bool> auto&& endpoint_candidates,
-				vertex_property_of<decltype(graph), bool> auto&& used_vertices,
-				vertex_id_t<decltype(graph)> start_vertex,
-				std::optional<edge_id_t<decltype(graph)>> source_edge,
-				std::output_iterator<edge_id_t<decltype(graph)>> auto& output_edges)
+		}
+
+		namespace stats {
+			template<typename T>
+			struct avg_val {
+				T sum{};
+				int samples{};
+
+				void add(T val){sum += val; ++samples;}
+				[[nodiscard]] T get() const {
+					if(samples == 0) {
+						return {};
+					} else {
+						return sum / samples;
+					}
+				}
+			};
+
+			inline thread_local std::array<avg_val<double>, 100> hopcroft_karp_deg_vs_cost;
+		}
+
+		/*
+		 * Buffers of the Hopcroft-Karp phases of max_bipartite_matching. They are sized on first use
+		 * and kept as long as the number of vertices stays the same, so passing one workspace to
+		 * repeated calls on graphs of the same size allocates nothing after the first call.
+		 * Each phase resets only the vertices it has visited and starts from a list of free left
+		 * vertices that is kept up to date as paths are augmented.
+		 *
+		 * Graphs without natural vertex numbering get new buffers on every call.
+		 */
+		template<graph GraphT>
+		class hopcroft_karp_workspace {
+		public:
+			using vertex_id_type = vertex_id_t<GraphT>;
+			using edge_id_type = edge_id_t<GraphT>;
+			using edge_type = edge_t<GraphT>;
+
+			/*
+			 * Augments a matching with the Hopcroft-Karp algorithm until it is maximum.
+			 * Partitions label left vertices with 0 and right vertices with 1.
+			 */
+			void augment_to_maximum(
+				const GraphT& graph,
+				vertex_property_of<GraphT, char> auto&& partitions,
+				edge_property_of<GraphT, bool> auto&& matching,
+				int matching_size)
 			{
-				bool source_matched = true;
-				if(source_edge) {
-					source_matched = matching[*source_edge];
+				insights::hopcroft_karp = {};
+				prepare(graph);
+				find_free_vertices(graph, partitions, matching);
+
+				while(true) {
+					const auto& aug_set = run_phase(graph, partitions, matching);
+					if(aug_set.empty()) {
+						break;
+					}
+					insights::hopcroft_karp.aug_set_sizes.push_back(aug_set.size());
+					insights::hopcroft_karp.aug_path_lengths.push_back(insights::hopcroft_karp.longest_augmenting_path);
+					int prev_matching_size = matching_size;
+
+					for(const auto& idx: aug_set) {
+						matching[idx] = !matching[idx];
+						matching_size += matching[idx] ? 1 : -1;
+					}
+
+					insights::hopcroft_karp.new_matched_edges_per_step.push_back(matching_size - prev_matching_size);
+					++insights::hopcroft_karp.num_iterations;
+
+					std::erase_if(free_left_, [&](const auto& v) {return bool(vtx_matched_[v]);});
 				}
+			}
 
-				if(endpoint_candidates[start_vertex]) {
-					*output_edges++ = *source_edge;
-					return true;
+			/*
+			 * Runs a single phase, like find_bipartite_augmenting_set. The returned edge ids
+			 * are valid until the next call.
+			 */
+			const std::vector<edge_id_type>& find_augmenting_set(
+				const GraphT& graph,
+				vertex_property_of<GraphT, char> auto&& partitions,
+				edge_property_of<GraphT, bool> auto&& matching)
+			{
+				prepare(graph);
+				find_free_vertices(graph, partitions, matching);
+				return run_phase(graph, partitions, matching);
+			}
+
+		private:
+			template<typename T>
+			using vertex_property_type = decltype(create_vertex_property<T>(std::declval<const GraphT&>()));
+
+			void prepare(const GraphT& graph) {
+				if constexpr(graph_traits::has_natural_vertex_numbering_v<GraphT>) {
+					if(std::ssize(levels_) == num_vertices(graph)) {
+						return;
+					}
 				}
+				levels_ = create_vertex_property<int>(graph, -1);
+				vtx_matched_ = create_vertex_property<boolean>(graph, false);
+				endpoint_candidates_ = create_vertex_property<boolean>(graph, false);
+				used_vertices_ = create_vertex_property<boolean>(graph, false);
+				vertex_ratings_ = {};
+			}
 
-				std::vector<edge_t<decltype(graph)>> out_edges = outgoing_edges(graph, start_vertex) | std::ranges::to<std::vector>();
-				using enum config::hk73_edge_choice_strategy_t;
-				if(config::hopcroft_karp.edge_choice_strategy == lowest_ranked_first) {
-					std::ranges::sort(out_edges, [&](const auto& ea, const auto& eb) {
-						return rate_edge(graph, ea) < rate_edge(graph, eb);
-					});
-				} else if(config::hopcroft_karp.edge_choice_strategy == random) {
-					std::ranges::shuffle(out_edges, config::hopcroft_karp.random_generator);
+			static void fill_vertex_property(const GraphT& graph, auto& property, const auto& value) {
+				if constexpr(std::ranges::contiguous_range<decltype(property)>) {
+					std::ranges::fill(property, value);
 				} else {
-					//TODO avoid copy for this case
+					for(const auto& v: all_vertices(graph)) {
+						property[v] = value;
+					}
 				}
+			}
 
-
-				for(const auto& [u, v, i]: out_edges/*outgoing_edges(graph, start_vertex)*/) {
-					if(not used_vertices[v] && bfs_levels[v] - bfs_levels[u] == 1 && matching[i] != source_matched) {
-						const auto& [u1, v1, i1] = edge_at(graph, i);
-						if(hopcroft_karp_dfs_step(graph, matching, bfs_levels, endpoint_candidates, used_vertices, v, i, output_edges)) {
-							if(source_edge) {
-								const auto& [u2, v2, i2] = edge_at(graph, *source_edge);
-								*output_edges++ = *source_edge;
-							}
-							return true;
-						}
+			/*
+			 * Marks the endpoints of matched edges and lists the free left vertices. After that,
+			 * augmenting along the paths of a phase only matches their first and last vertices,
+			 * which the DFS marks as it finds the paths.
+			 */
+			void find_free_vertices(const GraphT& graph, auto&& partitions, auto&& matching) {
+				fill_vertex_property(graph, vtx_matched_, boolean(false));
+				for(const auto& [u, v, i]: all_edges(graph)) {
+					if(matching[i]) {
+						vtx_matched_[u] = true;
+						vtx_matched_[v] = true;
 					}
 				}
+				free_left_.clear();
+				for(const auto& v: all_vertices(graph)) {
+					if(partitions[v] == 0 && not vtx_matched_[v]) {
+						free_left_.push_back(v);
+					}
+				}
+			}
 
-				return false;
+			const std::vector<edge_id_type>& run_phase(const GraphT& graph, auto&& partitions, auto&& matching) {
+				augmenting_set_.clear();
+
+				int aug_path_length = bfs_stage(graph, partitions, matching);
+				if(aug_path_length != std::numeric_limits<int>::max()) {
+					auto& l = insights::hopcroft_karp.longest_augmenting_path;
+					l = std::max(aug_path_length, l);
+					dfs_stage(graph, matching);
+				}
 
+				for(const auto& v: queue_) {
+					levels_[v] = -1;
+					used_vertices_[v] = false;
+					endpoint_candidates_[v] = false;
+				}
+				return augmenting_set_;
 			}
 
-			void hopcroft_karp_dfs_stage(
-				graph auto&& graph,
-				vertex_property_of<decltype(graph), int> auto&& bfs_levels,
-				g2x::detail::range_of_vertices_for<decltype(graph)> auto&& start_vertices,
-				vertex_property_of<decltype(graph), bool> auto&& endpoint_candidates,
-				auto&& output_augmenting_set,
-				edge_property_of<decltype(graph), bool> auto&& matching)
-			{
-				std::vector<edge_id_t<decltype(graph)>> augpath;
-				auto used_vertices = create_vertex_property<char>(graph, 0);
+			/*
+			 * Assigns BFS levels along alternating paths starting at the free left vertices,
+			 * up to the level of the nearest free right vertices, which become the endpoint
+			 * candidates. Every visited vertex is left in queue_, and the free left vertices
+			 * are its first num_start_vertices_ elements. Returns the length of the shortest
+			 * augmenting paths, or the maximum int if there are none.
+			 */
+			int bfs_stage(const GraphT& graph, auto&& partitions, auto&& matching) {
+				queue_.assign(free_left_.begin(), free_left_.end());
+				for(const auto& v: queue_) {
+					levels_[v] = 0;
+				}
+				num_start_vertices_ = queue_.size();
 
+				int aug_path_length = std::numeric_limits<int>::max();
+				for(std::size_t head=0; head<queue_.size(); head++) {
+					auto u = queue_[head];
+					if(levels_[u] > aug_path_length) { //search is past all shortest augmenting paths and should terminate
+						break;
+					}
+					if(partitions[u] == 1 && not vtx_matched_[u]) {
+						endpoint_candidates_[u] = true;
+						aug_path_length = levels_[u];
+						continue;
+					}
+					for(const auto& [u1, v, i]: outgoing_edges(graph, u)) {
+						bool is_alternating = matching[i]
+							? partitions[u] == 1 && partitions[v] == 0
+							: partitions[u] == 0 && partitions[v] == 1;
+						if(is_alternating && levels_[v] == -1) {
+							levels_[v] = levels_[u] + 1;
+							queue_.push_back(v);
+						}
+					}
+				}
 
-				
-				int dbg_num_aug_paths = 0;
-				std::optional<vertex_id_t<decltype(graph)>> dbg_endpoint;
-				for(const auto& v: all_vertices(graph)) {
-					if(endpoint_candidates[v]) {
-						dbg_endpoint = v;
+				for(const auto& v: queue_) {
+					if(levels_[v] == aug_path_length && not endpoint_candidates_[v]) {
+						levels_[v] = -1;
 					}
 				}
+				return aug_path_length;
+			}
+
+			void dfs_stage(const GraphT& graph, auto&& matching) {
+				start_vertices_.assign(queue_.begin(), queue_.begin() + num_start_vertices_);
 
-				auto start_vertices_vec = start_vertices | std::ranges::to<std::vector>();
 				using enum config::hk73_vertex_choice_strategy_t;
 				if(config::hopcroft_karp.vertex_choice_strategy == lowest_ranked_adj_edge_first) {
-					auto vertex_ratings = create_vertex_property<double>(graph, 9999.0);
+					// only allocated if this strategy is used
+					if(std::ssize(vertex_ratings_) != num_vertices(graph)) {
+						vertex_ratings_ = create_vertex_property<double>(graph);
+					}
+					fill_vertex_property(graph, vertex_ratings_, 9999.0);
 					for(const auto& e: all_edges(graph)) {
 						const auto& [u, v, i] = e;
-						vertex_ratings[u] = std::min(vertex_ratings[u], rate_edge(graph, e));
-						vertex_ratings[v] = std::min(vertex_ratings[v], rate_edge(graph, e));
+						vertex_ratings_[u] = std::min(vertex_ratings_[u], detail::rate_edge(graph, e));
+						vertex_ratings_[v] = std::min(vertex_ratings_[v], detail::rate_edge(graph, e));
 					}
-					std::ranges::sort(start_vertices_vec, [&](const auto& v1, const auto& v2) {
-						return vertex_ratings[v1] < vertex_ratings[v2];
+					std::ranges::sort(start_vertices_, [&](const auto& v1, const auto& v2) {
+						return vertex_ratings_[v1] < vertex_ratings_[v2];
 					});
 				} else if(config::hopcroft_karp.vertex_choice_strategy == random) {
-					std::ranges::shuffle(start_vertices_vec, config::hopcroft_karp.random_generator);
+					std::ranges::shuffle(start_vertices_, config::hopcroft_karp.random_generator);
+				}
+
+				using enum config::hk73_edge_choice_strategy_t;
+				if(config::hopcroft_karp.edge_choice_strategy == unspecified) {
+					find_paths(direct_stack_, matching, [&](const vertex_id_type& u, std::size_t) {
+						return outgoing_edges(graph, u);
+					});
 				} else {
-					//TODO avoid copy for this case
+					find_paths(buffered_stack_, matching, [&](const vertex_id_type& u, std::size_t depth) {
+						// a deque, so that deeper frames can add buffers without moving this one
+						if(edge_buffers_.size() <= depth) {
+							edge_buffers_.resize(depth + 1);
+						}
+						auto& out_edges = edge_buffers_[depth];
+						out_edges.clear();
+						std::ranges::copy(outgoing_edges(graph, u), std::back_inserter(out_edges));
+						if(config::hopcroft_karp.edge_choice_strategy == lowest_ranked_first) {
+							std::ranges::sort(out_edges, [&](const auto& ea, const auto& eb) {
+								return detail::rate_edge(graph, ea) < detail::rate_edge(graph, eb);
+							});
+						} else if(config::hopcroft_karp.edge_choice_strategy == random) {
+							std::ranges::shuffle(out_edges, config::hopcroft_karp.random_generator);
+						}
+						return std::span<const edge_type>(out_edges);
+					});
 				}
+			}
 
-				
-				for(const auto& start_vtx: start_vertices_vec /*start_vertices*/) {
-					if(used_vertices[start_vtx]) {
+			/*
+			 * A vertex on the path being extended by the DFS, with the range of its outgoing
+			 * edges and its current arc, i.e. the next edge to try. Frames may refer to their
+			 * own edge ranges, so they are kept in a std::deque, which never moves them.
+			 */
+			template<typename RangeT>
+			struct dfs_frame {
+				vertex_id_type vertex;
+				std::optional<edge_id_type> source_edge;
+				RangeT edges;
+				std::ranges::iterator_t<RangeT> next;
+
+				dfs_frame(const vertex_id_type& vertex, std::optional<edge_id_type> source_edge, RangeT edges)
+					: vertex(vertex), source_edge(source_edge), edges(std::move(edges)), next(std::ranges::begin(this->edges))
+				{}
+			};
+
+			/*
+			 * Depth-first search for vertex-disjoint augmenting paths along the BFS levels,
+			 * from every start vertex in turn, with an explicit stack of frames. A vertex whose
+			 * edges are exhausted is a dead end for the rest of the phase and is marked as used,
+			 * so every edge is tried at most once per phase. The edges of every path found are
+			 * appended to augmenting_set_.
+			 */
+			template<typename RangeT>
+			void find_paths(std::deque<dfs_frame<RangeT>>& stack, auto&& matching, auto&& edges_of) {
+				for(const auto& start_vtx: start_vertices_) {
+					if(used_vertices_[start_vtx]) {
 						continue;
 					}
+					stack.emplace_back(start_vtx, std::nullopt, edges_of(start_vtx, 0));
+					while(not stack.empty()) {
+						auto& frame = stack.back();
+						const auto& u = frame.vertex;
+						bool source_matched = frame.source_edge ? bool(matching[*frame.source_edge]) : true;
+						frame.next = std::ranges::find_if(frame.next, std::ranges::end(frame.edges), [&](const auto& edge) {
+							const auto& [u1, v, i] = edge;
+							return not used_vertices_[v]
+								&& levels_[v] - levels_[u] == 1
+								&& bool(matching[i]) != source_matched;
+						});
+						if(frame.next == std::ranges::end(frame.edges)) {
+							// no augmenting path of this phase passes through u anymore
+							used_vertices_[u] = true;
+							stack.pop_back();
+							continue;
+						}
 
-					augpath.clear();
-					auto augpath_back_inserter = std::back_inserter(augpath);
-					if(hopcroft_karp_dfs_step(
-							graph, matching, bfs_levels, endpoint_candidates,
-							used_vertices, start_vtx, std::nullopt, augpath_back_inserter))
-					{
-						for(const auto& i: augpath) {
-							const auto& [u, v, _] = edge_at(graph, i);
-							used_vertices[u] = true;
-							used_vertices[v] = true;
-							// std::println("consuming edge {}({}), {}({}), #{} (matched={})",
-							// 	u, bfs_levels[u], v, bfs_levels[v], i, bool(matching[i]));
-							*output_augmenting_set++ = i;
+						const auto [u1, v, i] = *frame.next++;
+						if(endpoint_candidates_[v]) {
+							used_vertices_[v] = true;
+							vtx_matched_[v] = true;
+							vtx_matched_[stack.front().vertex] = true;
+							augmenting_set_.push_back(i);
+							for(const auto& path_frame: stack | std::views::reverse) {
+								used_vertices_[path_frame.vertex] = true;
+								if(path_frame.source_edge) {
+									augmenting_set_.push_back(*path_frame.source_edge);
+								}
+							}
+							stack.clear();
+						} else {
+							stack.emplace_back(v, i, edges_of(v, stack.size()));
 						}
-						dbg_num_aug_paths++;
 					}
-
 				}
-				
-				// std::println("debug: {} augmenting paths found (length {})", dbg_num_aug_paths, bfs_levels[*dbg_endpoint]);
 			}
-			
+
+			using outgoing_range_type = decltype(outgoing_edges(std::declval<const GraphT&>(), std::declval<vertex_id_type>()));
+
+			vertex_property_type<int> levels_;
+			vertex_property_type<boolean> vtx_matched_;
+			vertex_property_type<boolean> endpoint_candidates_;
+			vertex_property_type<boolean> used_vertices_;
+			vertex_property_type<double> vertex_ratings_;
+
+			std::vector<vertex_id_type> free_left_;
+			std::vector<vertex_id_type> queue_;
+			std::size_t num_start_vertices_ = 0;
+			std::vector<vertex_id_type> start_vertices_;
+			std::deque<std::vector<edge_type>> edge_buffers_;
+			std::deque<dfs_frame<outgoing_range_type>> direct_stack_;
+			std::deque<dfs_frame<std::span<const edge_type>>> buffered_stack_;
+			std::vector<edge_id_type> augmenting_set_;
+		};
+
+		namespace detail {
+
+			/*
+			 * Augments a matching with the Hopcroft-Karp algorithm until it is maximum.
+			 */
+			void hopcroft_karp_augment_to_maximum(
+				graph auto&& graph,
+				vertex_property_of<decltype(graph), char> auto&& partitions,
+				edge_property_of<decltype(graph), bool> auto&& matching,
+				int matching_size)
+			{
+				hopcroft_karp_workspace<std::remove_cvref_t<decltype(graph)>> workspace;
+				workspace.augment_to_maximum(graph, partitions, matching, matching_size);
+			}
+
 		}
 
+		/*
+		 * Runs a single Hopcroft-Karp phase and returns the ids of the edges of a maximal set of
+		 * vertex-disjoint shortest augmenting paths.
+		 */
 		auto find_bipartite_augmenting_set(
 			graph auto&& graph,
 			vertex_property_of<decltype(graph), char> auto&& partitions,
 			edge_property_of<decltype(graph), bool> auto&& matching
 		) {
-			
-			int aug_path_length = -1;
-			auto bfs_levels = detail::hopcroft_karp_bfs_stage(graph, partitions, matching, &aug_path_length);
+			hopcroft_karp_workspace<std::remove_cvref_t<decltype(graph)>> workspace;
+			return workspace.find_augmenting_set(graph, partitions, matching);
+		}
 
-			{
-				auto& l = insights::hopcroft_karp.longest_augmenting_path;
-				l = std::max(aug_path_length, l);
-			}
-			
-			std::vector<vertex_id_t<decltype(graph)>> start_vertices;
-			auto endpoint_candidates = create_vertex_property(graph, char(false));
-			bool endpoint_candidates_exist = false;
-			
-			for(const auto& vtx: all_vertices(graph)) {
-				if(bfs_levels[vtx] == 0) {
-					start_vertices.push_back(vtx);
+		auto max_bipartite_matching(graph auto&& graph) {
+			auto partitions = bipartite_decompose(graph).value();
+			auto matching = create_edge_property<boolean>(graph, false);
+			detail::hopcroft_karp_augment_to_maximum(graph, partitions, matching, 0);
+			return matching;
+		}
+
+		/*
+		 * Like max_bipartite_matching(graph), but keeps the buffers of the Hopcroft-Karp phases in
+		 * a workspace that can be reused by later calls.
+		 */
+		template<graph GraphT>
+		auto max_bipartite_matching(const GraphT& graph, hopcroft_karp_workspace<GraphT>& workspace) {
+			auto partitions = bipartite_decompose(graph).value();
+			auto matching = create_edge_property<boolean>(graph, false);
+			workspace.augment_to_maximum(graph, partitions, matching, 0);
+			return matching;
+		}
+
+		/*
+		 * Like max_bipartite_matching, but starts from a given matching instead of an empty one,
+		 * e.g. from karp_sipser_matching, which usually saves most of the Hopcroft-Karp phases.
+		 * Throws std::invalid_argument if initial_matching is not a matching.
+		 */
+		auto max_bipartite_matching(graph auto&& graph, edge_property_of<decltype(graph), bool> auto&& initial_matching) {
+			auto partitions = bipartite_decompose(graph).value();
+			auto matching = create_edge_property<boolean>(graph, false);
+			auto matched_vertices = create_vertex_property<boolean>(graph, false);
+			int matching_size = 0;
+
+			for(const auto& [u, v, i]: all_edges(graph)) {
+				if(not initial_matching[i]) {
+					continue;
 				}
-				if(bfs_levels[vtx] == aug_path_length) {
-					endpoint_candidates[vtx] = true;
-					endpoint_candidates_exist = true;
+				if(matched_vertices[u] || matched_vertices[v]) {
+					throw std::invalid_argument(std::format("the initial matching has two edges incident to vertex {}", matched_vertices[u] ? u : v));
 				}
+				matched_vertices[u] = true;
+				matched_vertices[v] = true;
+				matching[i] = true;
+				++matching_size;
 			}
 
-			if(not endpoint_candidates_exist) {
-				return std::vector<edge_id_t<decltype(graph)>>{};
-			}
-			
-			std::vector<edge_id_t<decltype(graph)>> augmenting_set;
-			auto aug_set_output = std::back_inserter(augmenting_set);
-			detail::hopcroft_karp_dfs_stage(graph, bfs_levels, start_vertices, endpoint_candidates, aug_set_output, matching);
-			
-			return augmenting_set;
-			
+			detail::hopcroft_karp_augment_to_maximum(graph, partitions, matching, matching_size);
+			return matching;
 		}
 
-		namespace stats {
-			template<typename T>
-			struct avg_val {
-				T sum{};
-				int samples{};
+		namespace detail {
 
-				void add(T val){sum += val; ++samples;}
-				[[nodiscard]] T get() const {
-					if(samples == 0) {
-						return {};
-					} else {
-						return sum / samples;
+			// number of frontier or start vertices claimed by a worker at a time
+			inline constexpr isize parallel_hopcroft_karp_chunk_size = 256;
+
+			inline constexpr isize parallel_hopcroft_karp_min_vertices_per_worker = 1 << 14;
+
+			/*
+			 * State of the parallel matching algorithms. Matched vertices hold the id of their
+			 * mate and of the matched edge, free vertices have a mate of -1.
+			 */
+			template<typename GraphT>
+			struct parallel_matching_state {
+				using vertex_id_type = vertex_id_t<GraphT>;
+				using edge_id_type = edge_id_t<GraphT>;
+
+				std::vector<char> is_right;
+				std::vector<isize> mate_vertex;
+				std::vector<edge_id_type> mate_edge;
+				std::vector<int> levels;
+				std::vector<boolean> used_vertices;
+				std::vector<vertex_id_type> free_left_vertices;
+				std::vector<vertex_id_type> frontier;
+				std::vector<vertex_id_type> next;
+				std::vector<std::vector<vertex_id_type>> local_next;
+				std::vector<isize> local_offsets;
+
+				parallel_matching_state(const GraphT& graph, const auto& partitions, int num_workers)
+					: is_right(num_vertices(graph)),
+					  mate_vertex(num_vertices(graph), -1),
+					  mate_edge(num_vertices(graph)),
+					  levels(num_vertices(graph), -1),
+					  used_vertices(num_vertices(graph), false),
+					  local_next(num_workers),
+					  local_offsets(num_workers + 1, 0)
+				{
+					for(const auto& v: all_vertices(graph)) {
+						is_right[v] = partitions[v] == 1;
 					}
+					frontier.reserve(num_vertices(graph));
+					next.reserve(num_vertices(graph));
 				}
 			};
 
-			inline thread_local std::array<avg_val<double>, 100> hopcroft_karp_deg_vs_cost;
+			/*
+			 * Runs the layered BFS of the Hopcroft-Karp algorithm in parallel, one level of left
+			 * vertices at a time. Right vertices are claimed by a compare-and-swap on their level,
+			 * and the mate of a right vertex can only be reached through it, so it needs no claiming.
+			 * Returns the level of the nearest free right vertices, or -1 if none are reachable.
+			 */
+			template<typename GraphT>
+			int parallel_hopcroft_karp_bfs_stage(int num_workers, const GraphT& graph, parallel_matching_state<GraphT>& s) {
+				std::ranges::fill(s.levels, -1);
+				s.frontier.clear();
+				for(const auto& v: all_vertices(graph)) {
+					if(not s.is_right[v] && s.mate_vertex[v] == -1) {
+						s.levels[v] = 0;
+						s.frontier.push_back(v);
+					}
+				}
+				s.free_left_vertices.assign(s.frontier.begin(), s.frontier.end());
+
+				std::atomic<isize> cursor = 0;
+				std::atomic<bool> found = false;
+				int left_level = 0;
+				int result = -1;
+
+				auto merge_step = [&]() noexcept {
+					for(int w=0; w<num_workers; w++) {
+						s.local_offsets[w + 1] = s.local_offsets[w] + std::ssize(s.local_next[w]);
+					}
+					s.next.resize(s.local_offsets[num_workers]);
+				};
+				auto advance_step = [&]() noexcept {
+					if(found.load(std::memory_order_relaxed)) {
+						result = left_level + 1;
+						s.frontier.clear();
+					} else {
+						std::swap(s.frontier, s.next);
+					}
+					cursor.store(0, std::memory_order_relaxed);
+					left_level += 2;
+				};
+				std::barrier expanded(num_workers, merge_step);
+				std::barrier merged(num_workers, advance_step);
+
+				g2x::detail::run_workers(num_workers, [&](int w) {
+					auto& discovered = s.local_next[w];
+					while(not s.frontier.empty()) {
+						discovered.clear();
+						isize frontier_size = std::ssize(s.frontier);
+						isize begin;
+						while((begin = cursor.fetch_add(parallel_hopcroft_karp_chunk_size, std::memory_order_relaxed)) < frontier_size) {
+							isize end = std::min(begin + parallel_hopcroft_karp_chunk_size, frontier_size);
+							for(isize k=begin; k<end; k++) {
+								for(const auto& [u, v, i]: outgoing_edges(graph, s.frontier[k])) {
+									std::atomic_ref<int> level(s.levels[v]);
+									int expected = -1;
+									if(level.load(std::memory_order_relaxed) != -1
+										|| not level.compare_exchange_strong(expected, left_level + 1, std::memory_order_relaxed)
+									) {
+										continue;
+									}
+									if(s.mate_vertex[v] == -1) {
+										found.store(true, std::memory_order_relaxed);
+									} else {
+										auto mate = s.mate_vertex[v];
+										s.levels[mate] = left_level + 2;
+										discovered.push_back(vertex_id_t<GraphT>(mate));
+									}
+								}
+							}
+						}
+						expanded.arrive_and_wait();
+						std::ranges::copy(discovered, s.next.begin() + s.local_offsets[w]);
+						merged.arrive_and_wait();
+					}
+				});
+
+				return result;
+			}
+
+			/*
+			 * Runs the DFS stage of the Hopcroft-Karp algorithm in parallel. The workers take free
+			 * left vertices from a shared cursor and search for augmenting paths in the layered graph,
+			 * claiming each right vertex they enter with an atomic flag in used_vertices. Claimed
+			 * vertices are never released, so the paths are vertex-disjoint and each worker can
+			 * augment its path as soon as it is found. Returns the number of augmenting paths.
+			 *
+			 * Two workers may block each other from paths that either of them alone would have
+			 * found, so the set of paths is not always maximal, but the caller only has to retry
+			 * sequentially if no path was found at all.
+			 */
+			template<typename GraphT>
+			isize parallel_hopcroft_karp_dfs_stage(int num_workers, const GraphT& graph, parallel_matching_state<GraphT>& s, int aug_path_length) {
+				using vid_t = vertex_id_t<GraphT>;
+				using edges_view_type = decltype(outgoing_edges(graph, std::declval<vid_t>()));
+
+				struct dfs_frame {
+					vid_t u;
+					edges_view_type edges;
+					std::ranges::iterator_t<edges_view_type> cursor;
+					isize via_vertex = -1;
+					edge_id_t<GraphT> via_edge {};
+
+					dfs_frame(const GraphT& graph, vid_t u)
+						: u(u), edges(outgoing_edges(graph, u)), cursor(std::ranges::begin(edges)) {}
+				};
+
+				std::ranges::fill(s.used_vertices, false);
+				std::atomic<isize> start_cursor = 0;
+				std::atomic<isize> num_augmented = 0;
+				isize num_starts = std::ssize(s.free_left_vertices);
+
+				g2x::detail::run_workers(num_workers, [&](int) {
+					// frames refer to their own edge views, so they must not be moved, which std::deque ensures
+					std::deque<dfs_frame> stack;
+					isize local_augmented = 0;
+					isize begin;
+					while((begin = start_cursor.fetch_add(parallel_hopcroft_karp_chunk_size, std::memory_order_relaxed)) < num_starts) {
+						isize end = std::min(begin + parallel_hopcroft_karp_chunk_size, num_starts);
+						for(isize k=begin; k<end; k++) {
+							stack.clear();
+							stack.emplace_back(graph, s.free_left_vertices[k]);
+							while(not stack.empty()) {
+								auto& top = stack.back();
+								if(top.cursor == std::ranges::end(top.edges)) {
+									stack.pop_back();
+									continue;
+								}
+								const auto [u, v, i] = *top.cursor;
+								++top.cursor;
+								if(s.levels[v] != s.levels[u] + 1) {
+									continue;
+								}
+								if(std::atomic_ref<boolean>(s.used_vertices[v]).exchange(true, std::memory_order_relaxed)) {
+									continue;
+								}
+								top.via_vertex = v;
+								top.via_edge = i;
+								if(s.mate_vertex[v] == -1) {
+									for(const auto& frame: stack) {
+										s.mate_vertex[frame.u] = frame.via_vertex;
+										s.mate_vertex[frame.via_vertex] = frame.u;
+										s.mate_edge[frame.u] = frame.via_edge;
+										s.mate_edge[frame.via_vertex] = frame.via_edge;
+									}
+									local_augmented++;
+									break;
+								}
+								if(s.levels[v] < aug_path_length) {
+									stack.emplace_back(graph, vid_t(s.mate_vertex[v]));
+								}
+							}
+						}
+					}
+					num_augmented.fetch_add(local_augmented, std::memory_order_relaxed);
+				});
+
+				return num_augmented.load();
+			}
+
 		}
 
-		auto max_bipartite_matching(graph auto&& graph) {
-			
+		/*
+		 * Multithreaded Hopcroft-Karp algorithm. Both the layered BFS and the search for
+		 * vertex-disjoint augmenting paths are split between the workers of the policy.
+		 * Returns a maximum matching in the same form as max_bipartite_matching.
+		 *
+		 * Each phase does O(V + E) work. The workers may miss paths that another worker
+		 * blocked, so a phase does not always find a maximal set of shortest augmenting paths,
+		 * and the sequential bound of O(sqrt(V)) phases does not carry over. Every phase still
+		 * augments at least one path, so there are at most V phases.
+		 *
+		 * Complexity: O(V * (V + E)) work in the worst case, close to O(E sqrt(V)) when the
+		 * workers rarely block each other
+		 */
+		template<graph GraphT>
+			requires graph_traits::has_natural_vertex_numbering_v<GraphT>
+		auto max_bipartite_matching(const execution::execution_policy auto& policy, const GraphT& graph) {
 			auto partitions = bipartite_decompose(graph).value();
-			auto matching = create_edge_property<boolean>(graph, false);
-			int matching_size = 0;
+			int num_workers = g2x::detail::num_workers_for(policy, num_vertices(graph), detail::parallel_hopcroft_karp_min_vertices_per_worker);
 
-			insights::hopcroft_karp = {};
+			detail::parallel_matching_state<GraphT> state(graph, partitions, num_workers);
 
+			insights::hopcroft_karp = {};
 
 			while(true) {
-				auto aug_set = find_bipartite_augmenting_set(graph, partitions, matching);
-				if(aug_set.empty()) {
+				int aug_path_length = detail::parallel_hopcroft_karp_bfs_stage(num_workers, graph, state);
+				if(aug_path_length == -1) {
 					break;
 				}
-				insights::hopcroft_karp.aug_set_sizes.push_back(aug_set.size());
-				insights::hopcroft_karp.aug_path_lengths.push_back(insights::hopcroft_karp.longest_augmenting_path);
-				int prev_matching_size = matching_size;
-
-				for(const auto& idx: aug_set) {
-					matching[idx] = !matching[idx];
-					matching_size += matching[idx] ? 1 : -1;
+				isize num_augmented = detail::parallel_hopcroft_karp_dfs_stage(num_workers, graph, state, aug_path_length);
+				if(num_augmented == 0) {
+					num_augmented = detail::parallel_hopcroft_karp_dfs_stage(1, graph, state, aug_path_length);
 				}
-
-				insights::hopcroft_karp.new_matched_edges_per_step.push_back(matching_size - prev_matching_size);
+				insights::hopcroft_karp.aug_set_sizes.push_back(int(num_augmented));
+				insights::hopcroft_karp.aug_path_lengths.push_back(aug_path_length);
 				++insights::hopcroft_karp.num_iterations;
 			}
-			
+
+			auto matching = create_edge_property<boolean>(graph, false);
+			for(const auto& v: all_vertices(graph)) {
+				if(not state.is_right[v] && state.mate_vertex[v] != -1) {
+					matching[state.mate_edge[v]] = true;
+				}
+			}
 			return matching;
 		}
 
-		auto greedy_maximal_matching(graph auto&& graph) {
+		namespace config {
 
-			auto matching = create_edge_property<boolean>(graph, false);
+			/*
+			 * Tunables of push_relabel_max_bipartite_matching. A global relabeling is performed
+			 * after every global_relabel_frequency * |V| pushes.
+			 */
+			struct push_relabel_params {
+				double global_relabel_frequency = 1.0;
+			};
+
+		}
+
+		/*
+		 * Maximum bipartite matching by the push-relabel method with FIFO selection of active
+		 * vertices, double pushes and periodic global relabeling (Cherkassky et al., 1998).
+		 *
+		 * Only right vertices carry labels, which are lower bounds on their distance to a free
+		 * right vertex in the residual graph. An active (free) left vertex is matched to
+		 * its lowest-labeled neighbor, whose previous mate becomes active, and that neighbor
+		 * is relabeled past the second-lowest label. Left vertices whose neighbors are all
+		 * at least |V| away cannot be matched and are dropped. Global relabeling recomputes
+		 * the exact labels by a BFS from the free right vertices.
+		 *
+		 * Returns a maximum matching in the same form as max_bipartite_matching.
+		 *
+		 * Complexity: O(E sqrt(V)) with global relabeling
+		 */
+		auto push_relabel_max_bipartite_matching(graph auto&& graph, const config::push_relabel_params& params = {}) {
+			using vid_t = vertex_id_t<decltype(graph)>;
+			using eid_t = edge_id_t<decltype(graph)>;
+
+			auto partitions = bipartite_decompose(graph).value();
+
+			int max_label = int(num_vertices(graph));
+			auto labels = create_vertex_property<int>(graph, max_label);
+			auto mate_vertex = create_vertex_property<std::optional<vid_t>>(graph, std::nullopt);
+			auto mate_edge = create_vertex_property<eid_t>(graph);
+
+			bfs_queue<std::remove_cvref_t<decltype(graph)>> relabel_queue;
+			relabel_queue.expect_up_to(num_vertices(graph));
+
+			auto global_relabel = [&]() {
+				relabel_queue.reset();
+				for(const auto& v: all_vertices(graph)) {
+					labels[v] = max_label;
+					if(partitions[v] == 1 && not mate_vertex[v]) {
+						labels[v] = 0;
+						relabel_queue.push(v);
+					}
+				}
+				while(relabel_queue.num_pending_items() > 0) {
+					auto v = relabel_queue.pop();
+					for(const auto& [v1, u, i]: outgoing_edges(graph, v)) {
+						if(labels[u] != max_label || mate_vertex[u] == v) {
+							continue;
+						}
+						labels[u] = labels[v] + 1;
+						if(auto w = mate_vertex[u]; w && labels[*w] == max_label) {
+							labels[*w] = labels[v] + 2;
+							relabel_queue.push(*w);
+						}
+					}
+				}
+			};
+
+			std::deque<vid_t> active;
+			for(const auto& v: all_vertices(graph)) {
+				if(partitions[v] == 0) {
+					active.push_back(v);
+				}
+			}
+
+			global_relabel();
+			isize relabel_threshold = std::max<isize>(1, isize(params.global_relabel_frequency * num_vertices(graph)));
+			isize pushes_since_relabel = 0;
+
+			while(not active.empty()) {
+				vid_t u = active.front();
+				active.pop_front();
+
+				if(pushes_since_relabel >= relabel_threshold) {
+					global_relabel();
+					pushes_since_relabel = 0;
+				}
+
+				int min_label = max_label;
+				int second_min_label = max_label;
+				std::optional<edge_t<decltype(graph)>> best_edge;
+				for(const auto& edge: outgoing_edges(graph, u)) {
+					const auto& [u1, v, i] = edge;
+					if(labels[v] < min_label) {
+						second_min_label = min_label;
+						min_label = labels[v];
+						best_edge = edge;
+					} else if(labels[v] < second_min_label) {
+						second_min_label = labels[v];
+					}
+				}
+				if(min_label >= max_label) {
+					continue; // no augmenting path can start at u
+				}
+
+				const auto& [u1, v, i] = *best_edge;
+				if(auto previous_mate = mate_vertex[v]) {
+					mate_vertex[*previous_mate] = std::nullopt;
+					active.push_back(*previous_mate);
+				}
+				mate_vertex[u] = v;
+				mate_vertex[v] = u;
+				mate_edge[u] = i;
+				mate_edge[v] = i;
+				labels[v] = std::min(second_min_label + 2, max_label);
+				++pushes_since_relabel;
+			}
+
+			auto matching = create_edge_property<boolean>(graph, false);
+			for(const auto& v: all_vertices(graph)) {
+				if(partitions[v] == 0 && mate_vertex[v]) {
+					matching[mate_edge[v]] = true;
+				}
+			}
+			return matching;
+		}
+
+		auto greedy_maximal_matching(graph auto&& graph) {
+
+			auto matching = create_edge_property<boolean>(graph, false);
 			auto matched_vertices = create_vertex_property<boolean>(graph, false);
 
 			for(const auto& u: all_vertices(graph)) {
 				for(const auto& [_, v, i]: outgoing_edges(graph, u)) {
-					if(not matched_vertices[u] && not matched_vertices[v]) {
+					if(matched_vertices[u]) {
+						break;
+					}
+					if(u != v && not matched_vertices[v]) {
 						matching[i] = true;
 						matched_vertices[u] = true;
 						matched_vertices[v] = true;
 					}
-					break;
 				}
 			}
 
 			return matching;
 		}
 
-		// Like max_bipartite_matching, but performs slightly better for near-cubic graphs.
+		namespace detail {
+
+			/*
+			 * State shared by the degree-driven greedy matchings: the matching, the matched vertices
+			 * and, for every vertex, the number of its edges to other unmatched vertices.
+			 */
+			template<typename GraphT>
+			struct greedy_matching_state {
+				using vertex_id_type = vertex_id_t<GraphT>;
+				using edge_type = edge_t<GraphT>;
+
+				const GraphT& graph_ref;
+				decltype(create_edge_property<boolean, GraphT>(std::declval<GraphT>())) matching;
+				decltype(create_vertex_property<boolean, GraphT>(std::declval<GraphT>())) matched_vertices;
+				decltype(create_vertex_property<isize, GraphT>(std::declval<GraphT>())) degrees;
+
+				explicit greedy_matching_state(const GraphT& graph)
+					: graph_ref(graph),
+					  matching(create_edge_property<boolean>(graph, false)),
+					  matched_vertices(create_vertex_property<boolean>(graph, false)),
+					  degrees(create_vertex_property<isize>(graph, 0))
+				{
+					for(const auto& u: all_vertices(graph)) {
+						for(const auto& [u1, v, i]: outgoing_edges(graph, u)) {
+							degrees[u] += (u != v);
+						}
+					}
+				}
+
+				/*
+				 * Adds an edge to the matching and calls on_degree_changed(w) for every
+				 * unmatched vertex w that has lost a neighbor.
+				 */
+				void match(const edge_type& edge, auto&& on_degree_changed) {
+					const auto& [u, v, i] = edge;
+					matching[i] = true;
+					matched_vertices[u] = true;
+					matched_vertices[v] = true;
+					for(const auto& x: {u, v}) {
+						for(const auto& [x1, w, j]: outgoing_edges(graph_ref, x)) {
+							if(not matched_vertices[w]) {
+								--degrees[w];
+								on_degree_changed(w);
+							}
+						}
+					}
+				}
+
+				// returns the edge from u to the unmatched neighbor of the lowest degree, if any
+				[[nodiscard]] std::optional<edge_type> min_degree_free_edge(const vertex_id_type& u) {
+					std::optional<edge_type> result;
+					isize best_degree = std::numeric_limits<isize>::max();
+					for(const auto& edge: outgoing_edges(graph_ref, u)) {
+						const auto& [u1, v, i] = edge;
+						if(u != v && not matched_vertices[v] && degrees[v] < best_degree) {
+							best_degree = degrees[v];
+							result = edge;
+						}
+					}
+					return result;
+				}
+			};
+
+		}
+
+		/*
+		 * Karp-Sipser heuristic: while there is an unmatched vertex with exactly one unmatched
+		 * neighbor, it is matched to that neighbor, which is never worse than optimal. Otherwise,
+		 * an arbitrary unmatched vertex is matched to its lowest-degree unmatched neighbor.
+		 * On sparse random graphs, the result is usually within a fraction of a percent of
+		 * maximum, which makes it a good starting point for max_bipartite_matching.
+		 *
+		 * Complexity: O(V + E)
+		 */
+		auto karp_sipser_matching(graph auto&& graph) {
+			detail::greedy_matching_state<std::remove_cvref_t<decltype(graph)>> state(graph);
+
+			std::vector<vertex_id_t<decltype(graph)>> degree_one_vertices;
+			auto on_degree_changed = [&](const auto& w) {
+				if(state.degrees[w] == 1) {
+					degree_one_vertices.push_back(w);
+				}
+			};
+			auto match_from = [&](const auto& u) {
+				if(auto edge = state.min_degree_free_edge(u)) {
+					state.match(*edge, on_degree_changed);
+				}
+			};
+
+			for(const auto& v: all_vertices(graph)) {
+				on_degree_changed(v);
+			}
+
+			for(const auto& u: all_vertices(graph)) {
+				while(not degree_one_vertices.empty()) {
+					auto v = degree_one_vertices.back();
+					degree_one_vertices.pop_back();
+					if(not state.matched_vertices[v]) {
+						match_from(v);
+					}
+				}
+				if(not state.matched_vertices[u]) {
+					match_from(u);
+				}
+			}
+
+			return std::move(state.matching);
+		}
+
+		/*
+		 * Min-degree greedy heuristic: repeatedly matches the unmatched vertex of the lowest
+		 * current degree to its unmatched neighbor of the lowest current degree.
+		 *
+		 * Complexity: O((V + E) log V)
+		 */
+		auto min_degree_greedy_matching(graph auto&& graph) {
+			using vid_t = vertex_id_t<decltype(graph)>;
+
+			detail::greedy_matching_state<std::remove_cvref_t<decltype(graph)>> state(graph);
+
+			using queue_entry = std::pair<isize, vid_t>;
+			std::priority_queue<queue_entry, std::vector<queue_entry>, std::greater<>> queue;
+			auto on_degree_changed = [&](const auto& w) {
+				queue.emplace(state.degrees[w], w);
+			};
+
+			for(const auto& v: all_vertices(graph)) {
+				on_degree_changed(v);
+			}
+
+			while(not queue.empty()) {
+				auto [degree, u] = queue.top();
+				queue.pop();
+				if(state.matched_vertices[u] || degree != state.degrees[u] || degree == 0) {
+					continue; // outdated entry
+				}
+				if(auto edge = state.min_degree_free_edge(u)) {
+					state.match(*edge, on_degree_changed);
+				}
+			}
+
+			return std::move(state.matching);
+		}
+
+		/*
+		 * Like max_bipartite_matching, but performs slightly better for near-cubic graphs.
+		 *
+		 * The free left vertices and the vertices levelled by the BFS are kept in worklists,
+		 * so setting up a phase takes time proportional to the previous one rather than to V.
+		 */
 		auto near_cubic_max_bipartite_matching(graph auto&& graph) {
 
 			insights::hopcroft_karp = {};
@@ -491,8 +1248,9 @@ namespace g2x {
 			auto partitions = bipartite_decompose(graph).value();
 			auto matching = create_edge_property<boolean>(graph, false);
 
-			auto bfs_levels = create_vertex_property<int>(graph, -1);
+			auto bfs_levels = create_vertex_property<int>(graph, -9999);
 			auto matched_vertices = create_vertex_property<boolean>(graph, false);
+			std::vector<vertex_id_t<decltype(graph)>> levelled_vertices;
 
 			std::vector<edge_id_t<decltype(graph)>> aug_set;
 			aug_set.reserve(num_vertices(graph));
@@ -526,6 +1284,11 @@ namespace g2x {
 			bfs.expect_up_to(num_vertices(graph));
 			dfs.expect_up_to(num_vertices(graph));
 
+			for(const auto& v: all_vertices(graph)) {
+				if(is_vtx_left_unmatched(v)) {
+					augpath_begin_candidates.push_back(v);
+				}
+			}
 
 			for(int it=0;;it++) {
 
@@ -534,18 +1297,18 @@ namespace g2x {
 				int phase_aug_path_length = std::numeric_limits<int>::max();
 
 				bfs.reset();
-				augpath_begin_candidates.clear();
-				for(const auto& v: all_vertices(graph)) {
+				for(const auto& v: levelled_vertices) {
 					bfs_levels[v] = -9999;
-					if(is_vtx_left_unmatched(v)) {
-						augpath_begin_candidates.push_back(v);
-						bfs.add_vertex(v);
-					}
+				}
+				levelled_vertices.clear();
+				for(const auto& v: augpath_begin_candidates) {
+					bfs.add_vertex(v);
 				}
 
 				while(auto v_opt = bfs.next_vertex()) {
 					auto v = *v_opt;
 					bfs.update_distances(v, bfs_levels);
+					levelled_vertices.push_back(v);
 					auto cur_distance = bfs_levels[v];
 					if(is_vtx_right_unmatched(v)) {
 						if(cur_distance > phase_aug_path_length) {
@@ -598,24 +1361,856 @@ namespace g2x {
 					matched_vertices[v] = true;
 				}
 				aug_set.clear();
+				std::erase_if(augpath_begin_candidates, [&](const auto& v) {return bool(matched_vertices[v]);});
+
+				++insights::hopcroft_karp.num_iterations;
+			}
+
+			return matching;
+		}
+
+
+		namespace detail {
+
+			/*
+			 * Scans the edges of a left vertex u, starting at its lookahead cursor, for an edge to
+			 * a free right vertex. Edges to matched vertices are skipped for good, since a matched
+			 * vertex never becomes free again in an augmenting path algorithm.
+			 */
+			template<typename GraphT>
+			std::optional<edge_t<GraphT>> pothen_fan_lookahead(
+				const GraphT& graph,
+				vertex_id_t<GraphT> u,
+				isize& cursor,
+				auto&& is_free_right_vertex)
+			{
+				for(const auto& edge: outgoing_edges(graph, u) | std::views::drop(cursor)) {
+					const auto& [u1, v, i] = edge;
+					++cursor;
+					if(is_free_right_vertex(v)) {
+						return edge;
+					}
+				}
+				return std::nullopt;
+			}
+
+			// scans adjacency lists backwards, if they can be, for the fairness heuristic of PF+
+			struct reverse_adjacency_projection {
+				auto operator()(auto&& edges) const {
+					using range_type = std::remove_cvref_t<decltype(edges)>;
+					if constexpr(std::ranges::bidirectional_range<range_type> && std::ranges::common_range<range_type>) {
+						return std::views::reverse(edges);
+					} else {
+						return std::views::all(edges);
+					}
+				}
+			};
+
+		}
+
+		/*
+		 * Pothen-Fan algorithm with lookahead and fairness (PF+). Each phase runs a DFS for
+		 * an augmenting path from every free left vertex, and the visited vertices are shared
+		 * by all searches of the phase, so every vertex is visited at most once per phase.
+		 * Before descending from a left vertex, its adjacency list is scanned for a free right
+		 * vertex from where the previous scan stopped (lookahead). Every other phase scans
+		 * adjacency lists in reverse (fairness). The algorithm ends after a phase without
+		 * augmenting paths.
+		 *
+		 * Returns a maximum matching in the same form as max_bipartite_matching.
+		 *
+		 * Complexity: O(VE), usually much faster on sparse graphs
+		 */
+		auto pothen_fan_max_bipartite_matching(graph auto&& graph) {
+			using graph_type = std::remove_cvref_t<decltype(graph)>;
+			using eid_t = edge_id_t<graph_type>;
+
+			auto partitions = bipartite_decompose(graph).value();
+			auto matching = create_edge_property<boolean>(graph, false);
+			auto matched_vertices = create_vertex_property<boolean>(graph, false);
+			auto lookahead_cursors = create_vertex_property<isize>(graph, 0);
+
+			auto edge_predicate = [&](auto&& edge) {
+				const auto& [u, v, i] = edge;
+				if(matching[i]) {
+					return partitions[u] == 1 && partitions[v] == 0;
+				} else {
+					return partitions[u] == 0 && partitions[v] == 1;
+				}
+			};
+			auto is_free_right_vertex = [&](auto&& v) {
+				return partitions[v] == 1 && not matched_vertices[v];
+			};
 
+			depth_first_search forward_dfs(graph, edge_predicate);
+			depth_first_search reverse_dfs(graph, edge_predicate, detail::always_true{}, detail::reverse_adjacency_projection{});
+			forward_dfs.expect_up_to(num_vertices(graph));
+			reverse_dfs.expect_up_to(num_vertices(graph));
+
+			std::vector<eid_t> aug_path;
+
+			auto run_phase = [&](auto& dfs) {
+				isize num_augmented = 0;
+				dfs.reset();
+				for(const auto& start: all_vertices(graph)) {
+					if(partitions[start] != 0 || matched_vertices[start]) {
+						continue;
+					}
+					dfs.add_vertex(start);
+					while(auto v_opt = dfs.next_vertex()) {
+						auto u = *v_opt;
+						if(partitions[u] != 0) {
+							continue;
+						}
+						if(auto free_edge = detail::pothen_fan_lookahead(graph, u, lookahead_cursors[u], is_free_right_vertex)) {
+							const auto& [u1, v, i] = *free_edge;
+							aug_path.clear();
+							aug_path.push_back(i);
+							dfs.trace_path(u, std::back_inserter(aug_path));
+							for(const auto& j: aug_path) {
+								matching[j] = !matching[j];
+							}
+							matched_vertices[start] = true;
+							matched_vertices[v] = true;
+							++num_augmented;
+							break;
+						}
+					}
+					dfs.discard_pending();
+				}
+				return num_augmented;
+			};
+
+			insights::hopcroft_karp = {};
+
+			for(int phase=0; ; phase++) {
+				isize num_augmented = (phase % 2 == 0) ? run_phase(forward_dfs) : run_phase(reverse_dfs);
 				++insights::hopcroft_karp.num_iterations;
+				if(num_augmented == 0) {
+					break;
+				}
 			}
 
 			return matching;
 		}
 
+		namespace detail {
+
+			/*
+			 * One phase of the multithreaded Pothen-Fan algorithm. Workers take free left vertices
+			 * from a shared cursor and run their DFS with lookahead, claiming right vertices with
+			 * atomic flags in used_vertices, so that the paths they find are vertex-disjoint and
+			 * can be augmented immediately. Returns the number of augmenting paths.
+			 */
+			template<bool Reversed, typename GraphT>
+			isize parallel_pothen_fan_phase(
+				int num_workers,
+				const GraphT& graph,
+				parallel_matching_state<GraphT>& s,
+				std::vector<isize>& lookahead_cursors)
+			{
+				using vid_t = vertex_id_t<GraphT>;
+
+				auto adjacency = [&graph](vid_t u) {
+					if constexpr(Reversed) {
+						return reverse_adjacency_projection{}(outgoing_edges(graph, u));
+					} else {
+						return outgoing_edges(graph, u);
+					}
+				};
+				using edges_view_type = decltype(adjacency(std::declval<vid_t>()));
+
+				struct dfs_frame {
+					vid_t u;
+					edges_view_type edges;
+					std::ranges::iterator_t<edges_view_type> cursor;
+					bool looked_ahead = false;
+					isize via_vertex = -1;
+					edge_id_t<GraphT> via_edge {};
+
+					dfs_frame(const auto& adjacency, vid_t u)
+						: u(u), edges(adjacency(u)), cursor(std::ranges::begin(edges)) {}
+				};
+
+				auto load_mate = [&](auto v) {
+					return std::atomic_ref<isize>(s.mate_vertex[v]).load(std::memory_order_relaxed);
+				};
+				auto try_claim = [&](auto v) {
+					return not std::atomic_ref<boolean>(s.used_vertices[v]).exchange(true, std::memory_order_relaxed);
+				};
+
+				std::ranges::fill(s.used_vertices, false);
+				s.free_left_vertices.clear();
+				for(const auto& v: all_vertices(graph)) {
+					if(not s.is_right[v] && s.mate_vertex[v] == -1) {
+						s.free_left_vertices.push_back(v);
+					}
+				}
+
+				std::atomic<isize> start_cursor = 0;
+				std::atomic<isize> num_augmented = 0;
+				isize num_starts = std::ssize(s.free_left_vertices);
+
+				g2x::detail::run_workers(num_workers, [&](int) {
+					// frames refer to their own edge views, so they must not be moved, which std::deque ensures
+					std::deque<dfs_frame> stack;
+					isize local_augmented = 0;
+
+					auto augment = [&]() {
+						for(const auto& frame: stack) {
+							s.mate_vertex[frame.u] = frame.via_vertex;
+							s.mate_edge[frame.u] = frame.via_edge;
+							s.mate_edge[frame.via_vertex] = frame.via_edge;
+							std::atomic_ref<isize>(s.mate_vertex[frame.via_vertex]).store(frame.u, std::memory_order_relaxed);
+						}
+						++local_augmented;
+					};
+
+					isize begin;
+					while((begin = start_cursor.fetch_add(parallel_hopcroft_karp_chunk_size, std::memory_order_relaxed)) < num_starts) {
+						isize end = std::min(begin + parallel_hopcroft_karp_chunk_size, num_starts);
+						for(isize k=begin; k<end; k++) {
+							stack.clear();
+							stack.emplace_back(adjacency, s.free_left_vertices[k]);
+							while(not stack.empty()) {
+								auto& top = stack.back();
+								if(not top.looked_ahead) {
+									top.looked_ahead = true;
+									auto free_edge = pothen_fan_lookahead(graph, top.u, lookahead_cursors[top.u], [&](auto v) {
+										return load_mate(v) == -1 && try_claim(v);
+									});
+									if(free_edge) {
+										const auto& [u, v, i] = *free_edge;
+										top.via_vertex = v;
+										top.via_edge = i;
+										augment();
+										break;
+									}
+								}
+								if(top.cursor == std::ranges::end(top.edges)) {
+									stack.pop_back();
+									continue;
+								}
+								const auto [u, v, i] = *top.cursor;
+								++top.cursor;
+								if(v == s.mate_vertex[u] || not try_claim(v)) {
+									continue;
+								}
+								top.via_vertex = v;
+								top.via_edge = i;
+								auto mate = load_mate(v);
+								if(mate == -1) {
+									augment();
+									break;
+								}
+								stack.emplace_back(adjacency, vid_t(mate));
+							}
+						}
+					}
+					num_augmented.fetch_add(local_augmented, std::memory_order_relaxed);
+				});
+
+				return num_augmented.load();
+			}
+
+		}
+
+		/*
+		 * Multithreaded variant of pothen_fan_max_bipartite_matching. The searches of a phase
+		 * are split between the workers of the policy, which claim right vertices atomically.
+		 * As with the parallel Hopcroft-Karp algorithm, a phase that finds no augmenting path
+		 * is repeated on a single worker before the algorithm ends.
+		 */
+		template<graph GraphT>
+			requires graph_traits::has_natural_vertex_numbering_v<GraphT>
+		auto pothen_fan_max_bipartite_matching(const execution::execution_policy auto& policy, const GraphT& graph) {
+			auto partitions = bipartite_decompose(graph).value();
+			int num_workers = g2x::detail::num_workers_for(policy, num_vertices(graph), detail::parallel_hopcroft_karp_min_vertices_per_worker);
+
+			detail::parallel_matching_state<GraphT> state(graph, partitions, num_workers);
+			std::vector<isize> lookahead_cursors(num_vertices(graph), 0);
+
+			auto run_phase = [&](int phase, int phase_workers) {
+				if(phase % 2 == 0) {
+					return detail::parallel_pothen_fan_phase<false>(phase_workers, graph, state, lookahead_cursors);
+				} else {
+					return detail::parallel_pothen_fan_phase<true>(phase_workers, graph, state, lookahead_cursors);
+				}
+			};
+
+			insights::hopcroft_karp = {};
+
+			for(int phase=0; ; phase++) {
+				isize num_augmented = run_phase(phase, num_workers);
+				if(num_augmented == 0 && num_workers > 1) {
+					num_augmented = run_phase(phase, 1);
+				}
+				++insights::hopcroft_karp.num_iterations;
+				if(num_augmented == 0) {
+					break;
+				}
+			}
+
+			auto matching = create_edge_property<boolean>(graph, false);
+			for(const auto& v: all_vertices(graph)) {
+				if(not state.is_right[v] && state.mate_vertex[v] != -1) {
+					matching[state.mate_edge[v]] = true;
+				}
+			}
+			return matching;
+		}
 
+		/*
+		 * Maximum weight matching in a bipartite graph by the successive shortest path method
+		 * (the Hungarian algorithm), with Dijkstra's algorithm running on reduced costs.
+		 *
+		 * Every left vertex is given a private zero-weight alternative to being matched, so the
+		 * left vertices can be processed one at a time: each one starts a Dijkstra search
+		 * for the cheapest augmenting path, where the cost of an edge is its negated weight,
+		 * and the search ends either at a free right vertex or at the zero-weight alternative
+		 * of a left vertex, which leaves that vertex unmatched. Both kinds of ends are modelled
+		 * as edges into a common sink. Vertex potentials keep the reduced costs non-negative,
+		 * and only the vertices visited by a search are updated.
+		 *
+		 * "weights" is an edge property of a signed arithmetic type. Edges of non-positive
+		 * weight are never needed, but they are allowed.
+		 *
+		 * Complexity: O(V E log V)
+		 */
 		auto max_weight_bipartite_matching(graph auto&& graph, auto&& weights) {
-			//TODO
+			using graph_type = std::remove_cvref_t<decltype(graph)>;
+			using vid_t = vertex_id_t<graph_type>;
+			using edge_type = edge_t<graph_type>;
+			using weight_type = std::remove_cvref_t<decltype(weights[std::declval<edge_id_t<graph_type>>()])>;
+			static_assert(std::is_arithmetic_v<weight_type> && std::is_signed_v<weight_type>, "weights must be of a signed arithmetic type");
+
+			constexpr weight_type infinity = std::numeric_limits<weight_type>::max();
+
+			auto partitions = bipartite_decompose(graph).value();
+			auto potentials = create_vertex_property<weight_type>(graph, weight_type{});
+			auto distances = create_vertex_property<weight_type>(graph, infinity);
+			auto finalized = create_vertex_property<boolean>(graph, false);
+			auto parent_edges = create_vertex_property<std::optional<edge_type>>(graph, std::nullopt);
+			auto mates = create_vertex_property<std::optional<edge_type>>(graph, std::nullopt);
+
+			auto is_mate_edge = [&](const vid_t& v, const auto& eid) {
+				if(not mates[v]) {
+					return false;
+				}
+				const auto& [v1, w, i] = *mates[v];
+				return i == eid;
+			};
+
+			// makes the reduced costs of all edges non-negative
+			for(const auto& u: all_vertices(graph)) {
+				if(partitions[u] == 0) {
+					for(const auto& [u1, v, i]: outgoing_edges(graph, u)) {
+						potentials[v] = std::min<weight_type>(potentials[v], -weights[i]);
+					}
+				}
+			}
+
+			// a search ends with a zero-cost step from a free right vertex or from a left vertex that
+			// is left unmatched into a common sink, whose potential never changes
+			weight_type sink_potential {};
+			for(const auto& v: all_vertices(graph)) {
+				sink_potential = std::min(sink_potential, potentials[v]);
+			}
+
+			std::vector<vid_t> touched;
+			using queue_entry = std::pair<weight_type, vid_t>;
+			std::priority_queue<queue_entry, std::vector<queue_entry>, std::greater<>> queue;
+
+			for(const auto& source: all_vertices(graph)) {
+				if(partitions[source] != 0) {
+					continue;
+				}
+
+				weight_type best = infinity;
+				vid_t terminal = source;
+				bool terminal_is_alternative = false;
+
+				auto relax = [&](const vid_t& v, weight_type distance) {
+					if(distance < distances[v]) {
+						if(distances[v] == infinity) {
+							touched.push_back(v);
+						}
+						distances[v] = distance;
+						queue.emplace(distance, v);
+						return true;
+					}
+					return false;
+				};
+
+				relax(source, 0);
+				while(not queue.empty()) {
+					auto [d, a] = queue.top();
+					queue.pop();
+					if(finalized[a] || d > distances[a]) {
+						continue;
+					}
+					if(d >= best) {
+						break;
+					}
+					finalized[a] = true;
+
+					if(partitions[a] == 0) {
+						if(d + potentials[a] - sink_potential < best) {
+							best = d + potentials[a] - sink_potential;
+							terminal = a;
+							terminal_is_alternative = true;
+						}
+						for(const auto& edge: outgoing_edges(graph, a)) {
+							const auto& [a1, b, i] = edge;
+							if(not is_mate_edge(a, i) && relax(b, d - weights[i] + potentials[a] - potentials[b])) {
+								parent_edges[b] = edge;
+							}
+						}
+					} else if(mates[a]) {
+						const auto& [a1, x, m] = *mates[a];
+						relax(x, d + weights[m] + potentials[a] - potentials[x]);
+					} else if(d + potentials[a] - sink_potential < best) {
+						best = d + potentials[a] - sink_potential;
+						terminal = a;
+						terminal_is_alternative = false;
+					}
+				}
+
+				for(const auto& v: touched) {
+					if(finalized[v]) {
+						potentials[v] += distances[v] - best;
+					}
+					distances[v] = infinity;
+					finalized[v] = false;
+				}
+				touched.clear();
+				queue = {};
+
+				// flip the augmenting path, starting from its end
+				std::optional<vid_t> right = terminal;
+				if(terminal_is_alternative) {
+					right = std::nullopt;
+					if(auto old_mate = mates[terminal]) {
+						const auto& [t, r, i] = *old_mate;
+						right = r;
+					}
+					mates[terminal] = std::nullopt;
+				}
+				while(right) {
+					const auto edge = *parent_edges[*right];
+					const auto& [l, r, i] = edge;
+					std::optional<vid_t> next_right;
+					if(auto old_mate = mates[l]) {
+						const auto& [l1, r1, i1] = *old_mate;
+						next_right = r1;
+					}
+					mates[l] = edge;
+					mates[r] = edge.swap_to_first(r);
+					right = next_right;
+				}
+			}
+
+			auto matching = create_edge_property<boolean>(graph, false);
+			for(const auto& v: all_vertices(graph)) {
+				if(partitions[v] == 0 && mates[v]) {
+					const auto& [u, w, i] = *mates[v];
+					matching[i] = true;
+				}
+			}
+			return matching;
+		}
+
+		namespace config {
+
+			struct auction_params {
+				// epsilon is divided by this factor after every scaling phase
+				double scaling_factor = 4.0;
+
+				// 0 selects 1/(|V| + 1) for integral weights, which makes the result optimal,
+				// and 1e-9 times the largest absolute weight for floating-point weights
+				double final_epsilon = 0.0;
+			};
+
 		}
 
+		namespace detail {
+
+			inline constexpr isize auction_min_bidders_per_worker = 1 << 12;
+
+		}
+
+		/*
+		 * Maximum weight matching in a bipartite graph by the epsilon-scaling auction algorithm
+		 * (Bertsekas). The problem is turned into a symmetric assignment problem with a perfect
+		 * solution: left vertices bid for right vertices or for a private zero-weight dummy,
+		 * and copies of the right vertices bid for themselves or for the dummies of their
+		 * neighbors. Bidding is Jacobi-style: in every round, all unassigned bidders compute
+		 * their bids in parallel, and each object goes to its highest bidder.
+		 *
+		 * The result is within |V| * final_epsilon of the maximum weight, which makes it exact
+		 * for integral weights with the default parameters. "weights" is read concurrently,
+		 * so it must be an edge property that allows that, e.g. a std::vector.
+		 *
+		 * Complexity: O(V E log(V C)) for integral weights of magnitude up to C
+		 */
+		template<graph GraphT>
+			requires graph_traits::has_natural_vertex_numbering_v<GraphT>
+		auto auction_max_weight_bipartite_matching(
+			const execution::execution_policy auto& policy,
+			const GraphT& graph,
+			auto&& weights,
+			const config::auction_params& params = {}
+		) {
+			using eid_t = edge_id_t<GraphT>;
+			using weight_type = std::remove_cvref_t<decltype(weights[std::declval<eid_t>()])>;
+			static_assert(std::is_arithmetic_v<weight_type>, "weights must be of an arithmetic type");
+
+			constexpr double minus_infinity = -std::numeric_limits<double>::infinity();
+
+			auto partitions = bipartite_decompose(graph).value();
+			isize n = num_vertices(graph);
+
+			double max_abs_weight = 0.0;
+			for(const auto& [u, v, i]: all_edges(graph)) {
+				max_abs_weight = std::max(max_abs_weight, std::abs(double(weights[i])));
+			}
+			double final_epsilon = params.final_epsilon;
+			if(final_epsilon <= 0.0) {
+				final_epsilon = std::is_integral_v<weight_type> ? 1.0 / double(n + 1) : 1e-9 * max_abs_weight;
+			}
+			if(final_epsilon <= 0.0) {
+				final_epsilon = 1.0 / double(n + 1);
+			}
+
+			// objects [0; n) are the right vertices, object n + v is the dummy of left vertex v
+			std::vector<double> prices(2 * n, 0.0);
+			std::vector<isize> owners(2 * n, -1);
+			std::vector<isize> best_bids(2 * n, -1);
+			std::vector<isize> assigned_objects(n, -1);
+			std::vector<eid_t> assigned_edges(n);
+
+			struct bid {
+				isize bidder;
+				isize object;
+				double amount;
+				eid_t edge;
+			};
+
+			double epsilon = std::max(final_epsilon, max_abs_weight / 2.0);
+
+			auto compute_bid = [&](isize b) {
+				double best_value = minus_infinity;
+				double second_value = minus_infinity;
+				bid result {b, -1, 0.0, {}};
+
+				auto consider = [&](isize object, double value, const eid_t& eid) {
+					if(value > best_value) {
+						second_value = best_value;
+						best_value = value;
+						result.object = object;
+						result.edge = eid;
+					} else if(value > second_value) {
+						second_value = value;
+					}
+				};
+
+				if(partitions[b] == 0) {
+					consider(n + b, -prices[n + b], {});
+					for(const auto& [b1, j, i]: outgoing_edges(graph, vertex_id_t<GraphT>(b))) {
+						consider(j, double(weights[i]) - prices[j], i);
+					}
+				} else {
+					consider(b, -prices[b], {});
+					for(const auto& [b1, j, i]: outgoing_edges(graph, vertex_id_t<GraphT>(b))) {
+						consider(n + j, -prices[n + j], i);
+					}
+				}
+				if(second_value == minus_infinity) {
+					second_value = best_value;
+				}
+				result.amount = prices[result.object] + (best_value - second_value) + epsilon;
+				return result;
+			};
+
+			std::vector<isize> unassigned;
+			std::vector<bid> bids;
+			std::vector<isize> bid_objects;
+
+			while(true) {
+				std::ranges::fill(owners, -1);
+				std::ranges::fill(assigned_objects, -1);
+				unassigned.resize(n);
+				std::iota(unassigned.begin(), unassigned.end(), isize(0));
+
+				while(not unassigned.empty()) {
+					bids.resize(unassigned.size());
+					int num_workers = g2x::detail::num_workers_for(policy, std::ssize(unassigned), detail::auction_min_bidders_per_worker);
+					g2x::detail::parallel_for_chunks(num_workers, std::ssize(unassigned), [&](int, isize begin, isize end) {
+						for(isize k=begin; k<end; k++) {
+							bids[k] = compute_bid(unassigned[k]);
+						}
+					});
+
+					for(isize k=0; k<std::ssize(bids); k++) {
+						auto& best = best_bids[bids[k].object];
+						if(best == -1) {
+							bid_objects.push_back(bids[k].object);
+							best = k;
+						} else if(bids[k].amount > bids[best].amount) {
+							best = k;
+						}
+					}
+
+					unassigned.clear();
+					for(isize k=0; k<std::ssize(bids); k++) {
+						if(best_bids[bids[k].object] != k) {
+							unassigned.push_back(bids[k].bidder);
+						}
+					}
+					for(const auto& object: bid_objects) {
+						const auto& winner = bids[best_bids[object]];
+						if(owners[object] != -1) {
+							assigned_objects[owners[object]] = -1;
+							unassigned.push_back(owners[object]);
+						}
+						owners[object] = winner.bidder;
+						assigned_objects[winner.bidder] = object;
+						assigned_edges[winner.bidder] = winner.edge;
+						prices[object] = winner.amount;
+						best_bids[object] = -1;
+					}
+					bid_objects.clear();
+				}
+
+				if(epsilon <= final_epsilon) {
+					break;
+				}
+				epsilon = std::max(final_epsilon, epsilon / params.scaling_factor);
+			}
+
+			auto matching = create_edge_property<boolean>(graph, false);
+			for(isize v=0; v<n; v++) {
+				if(partitions[v] == 0 && assigned_objects[v] != -1 && assigned_objects[v] < n) {
+					matching[assigned_edges[v]] = true;
+				}
+			}
+			return matching;
+		}
+
+		template<graph GraphT>
+			requires graph_traits::has_natural_vertex_numbering_v<GraphT>
+		auto auction_max_weight_bipartite_matching(const GraphT& graph, auto&& weights, const config::auction_params& params = {}) {
+			return auction_max_weight_bipartite_matching(execution::seq, graph, weights, params);
+		}
+
+		/*
+		 * Minimum vertex cover of a bipartite graph, obtained from a maximum matching
+		 * by König's theorem. Let Z be the set of vertices reachable by alternating paths
+		 * from the free left vertices. Then (left \ Z) + (right & Z) covers every edge
+		 * and has exactly one endpoint of each matched edge.
+		 *
+		 * Returns a vertex property that is true for the vertices in the cover.
+		 * Throws std::invalid_argument if the graph is not bipartite.
+		 *
+		 * Complexity: that of max_bipartite_matching, plus O(V + E)
+		 */
 		auto min_bipartite_vertex_cover(graph auto&& graph) {
-			//TODO
+			auto partitions_opt = bipartite_decompose(graph);
+			if(not partitions_opt) {
+				throw std::invalid_argument("the graph is not bipartite");
+			}
+			auto& partitions = *partitions_opt;
+			auto matching = create_edge_property<boolean>(graph, false);
+			detail::hopcroft_karp_augment_to_maximum(graph, partitions, matching, 0);
+
+			auto reached = create_vertex_property(graph, boolean(false));
+			detail::alternating_search_from_free_left(graph, partitions, matching, [&](auto& bfs, const auto& v, bool is_free) {
+				reached[v] = true;
+				return false;
+			});
+
+			auto cover = create_vertex_property(graph, boolean(false));
+			for(const auto& v: all_vertices(graph)) {
+				cover[v] = (partitions[v] == 0) != bool(reached[v]);
+			}
+			return cover;
 		}
 
-		auto cycle_cover(graph auto&& graph) {
-			//TODO
+		namespace detail {
+
+			/*
+			 * Hopcroft-Karp on the bipartite double cover of a digraph, without building the cover.
+			 * The out copy of a vertex scans the outgoing edges of the vertex, and the in copy of
+			 * a vertex only stores the out copy it is matched to, so the search keeps O(V) state
+			 * and never needs incoming edges. BFS levels are kept for out copies only.
+			 */
+			template<graph GraphT>
+			class cycle_cover_search {
+			public:
+				using vertex_id_type = vertex_id_t<GraphT>;
+				using edge_id_type = edge_id_t<GraphT>;
+
+				explicit cycle_cover_search(const GraphT& graph)
+					: graph_(graph),
+					in_mates_(create_vertex_property<std::optional<vertex_id_type>>(graph, std::nullopt)),
+					out_edges_(create_vertex_property<std::optional<edge_id_type>>(graph, std::nullopt)),
+					levels_(create_vertex_property<int>(graph, -1))
+				{}
+
+				/*
+				 * Augments the matching until it is maximum and returns its size.
+				 */
+				isize augment_to_maximum() {
+					isize matching_size = 0;
+					while(true) {
+						int aug_path_level = bfs_stage();
+						if(aug_path_level == std::numeric_limits<int>::max()) {
+							return matching_size;
+						}
+						matching_size += dfs_stage(aug_path_level);
+					}
+				}
+
+				/*
+				 * The id of the edge each out copy is matched with.
+				 */
+				[[nodiscard]] const auto& matched_edges() const {
+					return out_edges_;
+				}
+
+			private:
+				using outgoing_range_type = decltype(outgoing_edges(std::declval<const GraphT&>(), std::declval<vertex_id_type>()));
+
+				/*
+				 * An out copy on the path being extended by the DFS. Its current arc stays on the
+				 * edge that leads to the next frame, so augmenting reads the path from the stack.
+				 */
+				struct dfs_frame {
+					vertex_id_type vertex;
+					outgoing_range_type edges;
+					std::ranges::iterator_t<outgoing_range_type> next;
+
+					dfs_frame(const vertex_id_type& vertex, outgoing_range_type edges)
+						: vertex(vertex), edges(std::move(edges)), next(std::ranges::begin(this->edges))
+					{}
+				};
+
+				/*
+				 * Assigns BFS levels to out copies along alternating paths from the free ones, and
+				 * returns the level of the nearest out copies with an edge to a free in copy, or the
+				 * maximum int if there are none. The free out copies are the first num_start_vertices_
+				 * elements of queue_.
+				 */
+				int bfs_stage() {
+					queue_.clear();
+					for(const auto& v: all_vertices(graph_)) {
+						levels_[v] = out_edges_[v] ? -1 : 0;
+						if(not out_edges_[v]) {
+							queue_.push_back(v);
+						}
+					}
+					num_start_vertices_ = queue_.size();
+
+					int aug_path_level = std::numeric_limits<int>::max();
+					for(std::size_t head=0; head<queue_.size(); head++) {
+						auto u = queue_[head];
+						if(levels_[u] > aug_path_level) {
+							break;
+						}
+						for(const auto& [u1, v, i]: outgoing_edges(graph_, u)) {
+							if(not in_mates_[v]) {
+								aug_path_level = levels_[u];
+							} else if(const auto& w = *in_mates_[v]; levels_[w] == -1) {
+								levels_[w] = levels_[u] + 1;
+								queue_.push_back(w);
+							}
+						}
+					}
+					return aug_path_level;
+				}
+
+				/*
+				 * Augments along vertex-disjoint shortest augmenting paths found by a DFS along the
+				 * BFS levels, and returns their number. Out copies that are dead ends or lie on a
+				 * path lose their level, so every edge is tried at most once per phase.
+				 */
+				isize dfs_stage(int aug_path_level) {
+					isize num_paths = 0;
+					for(std::size_t k=0; k<num_start_vertices_; k++) {
+						if(levels_[queue_[k]] != 0) {
+							continue;
+						}
+						stack_.emplace_back(queue_[k], outgoing_edges(graph_, queue_[k]));
+						while(not stack_.empty()) {
+							auto& frame = stack_.back();
+							int level = levels_[frame.vertex];
+							frame.next = std::ranges::find_if(frame.next, std::ranges::end(frame.edges), [&](const auto& edge) {
+								const auto& [u1, v, i] = edge;
+								return in_mates_[v] ? levels_[*in_mates_[v]] == level + 1 : level == aug_path_level;
+							});
+							if(frame.next == std::ranges::end(frame.edges)) {
+								levels_[frame.vertex] = -1;
+								stack_.pop_back();
+								continue;
+							}
+
+							const auto& [u, v, i] = *frame.next;
+							if(in_mates_[v]) {
+								auto w = *in_mates_[v];
+								stack_.emplace_back(w, outgoing_edges(graph_, w));
+								continue;
+							}
+							for(const auto& path_frame: stack_) {
+								const auto& [path_u, path_v, path_i] = *path_frame.next;
+								out_edges_[path_u] = path_i;
+								in_mates_[path_v] = path_u;
+								levels_[path_u] = -1;
+							}
+							stack_.clear();
+							++num_paths;
+						}
+					}
+					return num_paths;
+				}
+
+				const GraphT& graph_;
+				decltype(create_vertex_property<std::optional<vertex_id_type>>(std::declval<const GraphT&>())) in_mates_;
+				decltype(create_vertex_property<std::optional<edge_id_type>>(std::declval<const GraphT&>())) out_edges_;
+				decltype(create_vertex_property<int>(std::declval<const GraphT&>())) levels_;
+				std::vector<vertex_id_type> queue_;
+				std::size_t num_start_vertices_ = 0;
+				std::deque<dfs_frame> stack_;
+			};
+
+		}
+
+		/*
+		 * Finds a set of vertex-disjoint directed cycles that covers all vertices of a digraph,
+		 * i.e. a set of edges in which every vertex has exactly one outgoing and one incoming edge.
+		 * A loop covers its vertex on its own.
+		 *
+		 * Such edge sets are the perfect matchings of the bipartite double cover of the graph,
+		 * which Hopcroft-Karp searches for on the graph itself: out copies of vertices follow
+		 * outgoing edges, and in copies only remember their mates.
+		 *
+		 * Returns an edge property that is true for the edges of the cover, or std::nullopt
+		 * if the graph has no cycle cover.
+		 *
+		 * Complexity: O(E * sqrt(V)) time, O(V) memory besides the result
+		 */
+		template<graph GraphT>
+			requires graph_traits::is_directed_v<GraphT>
+		auto cycle_cover(const GraphT& graph) -> std::optional<decltype(create_edge_property<boolean>(graph))> {
+			detail::cycle_cover_search search(graph);
+			if(search.augment_to_maximum() < num_vertices(graph)) {
+				return std::nullopt;
+			}
+
+			auto result = create_edge_property<boolean>(graph, false);
+			for(const auto& v: all_vertices(graph)) {
+				result[*search.matched_edges()[v]] = true;
+			}
+			return result;
 		}
 
 
@@ -0,0 +1,185 @@
+
+#ifndef GRAPH2X_DENSE_BFS_HPP
+#define GRAPH2X_DENSE_BFS_HPP
+
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "../core.hpp"
+#include "../util.hpp"
+#include "search.hpp"
+
+namespace g2x {
+
+	namespace algo {
+
+		namespace detail {
+
+			using bitset_word = bit_matrix::word_type;
+			using bitset_storage = std::vector<bitset_word, g2x::detail::aligned_allocator<bitset_word, bit_matrix::alignment>>;
+
+			/*
+			 * Adds the vertices in "row" that are in "unvisited" but not yet in "next" to "next",
+			 * and calls on_discovered(v) for each of them. num_words must be a multiple of 8
+			 * and all pointers must be aligned to 64 bytes, which bit_matrix rows satisfy.
+			 *
+			 * Most words of a row contribute nothing once the search is under way, so only the
+			 * test for newly discovered vertices is vectorized, and the rare nonzero words are
+			 * processed one by one.
+			 */
+			inline void expand_frontier_row(
+				const bitset_word* row,
+				const bitset_word* unvisited,
+				bitset_word* next,
+				isize num_words,
+				auto&& on_discovered)
+			{
+				auto process_word = [&](isize w) {
+					bitset_word discovered = row[w] & unvisited[w] & ~next[w];
+					if(discovered == 0) {
+						return;
+					}
+					next[w] |= discovered;
+					while(discovered) {
+						on_discovered(w * 64 + std::countr_zero(discovered));
+						discovered &= discovered - 1;
+					}
+				};
+
+#if defined(__AVX512F__)
+				for(isize w=0; w<num_words; w+=8) {
+					__m512i r = _mm512_load_si512(row + w);
+					__m512i u = _mm512_load_si512(unvisited + w);
+					__m512i n = _mm512_load_si512(next + w);
+					__m512i discovered = _mm512_andnot_si512(n, _mm512_and_si512(r, u));
+					__mmask8 nonzero = _mm512_test_epi64_mask(discovered, discovered);
+					while(nonzero) {
+						process_word(w + std::countr_zero(unsigned(nonzero)));
+						nonzero &= nonzero - 1;
+					}
+				}
+#elif defined(__AVX2__)
+				for(isize w=0; w<num_words; w+=4) {
+					__m256i r = _mm256_load_si256(reinterpret_cast<const __m256i*>(row + w));
+					__m256i u = _mm256_load_si256(reinterpret_cast<const __m256i*>(unvisited + w));
+					__m256i n = _mm256_load_si256(reinterpret_cast<const __m256i*>(next + w));
+					__m256i discovered = _mm256_andnot_si256(n, _mm256_and_si256(r, u));
+					if(not _mm256_testz_si256(discovered, discovered)) {
+						for(isize k=0; k<4; k++) {
+							process_word(w + k);
+						}
+					}
+				}
+#else
+				for(isize w=0; w<num_words; w++) {
+					process_word(w);
+				}
+#endif
+			}
+
+			/*
+			 * Clears the bits of "next" in "unvisited" and returns whether "next" has any set bits.
+			 */
+			inline bool retire_frontier(bitset_word* unvisited, const bitset_word* next, isize num_words) {
+				bitset_word any = 0;
+				for(isize w=0; w<num_words; w++) {
+					unvisited[w] &= ~next[w];
+					any |= next[w];
+				}
+				return any != 0;
+			}
+
+			/*
+			 * Returns the adjacency of a graph as a bit_matrix: the graph's own if it is
+			 * a compact_dense_graph, otherwise a copy built from its adjacency lists.
+			 */
+			template<typename GraphT>
+			decltype(auto) adjacency_bit_matrix(const GraphT& graph) {
+				if constexpr(requires{{graph.adjacency_matrix()} -> std::same_as<const bit_matrix&>;}) {
+					return graph.adjacency_matrix();
+				} else {
+					isize n = num_vertices(graph);
+					bit_matrix result(n, n);
+					for(isize u=0; u<n; u++) {
+						for(auto v: adjacent_vertices(graph, u)) {
+							result.set(u, v, true);
+						}
+					}
+					return result;
+				}
+			}
+
+		}
+
+		/*
+		 * Breadth-first search for dense graphs. The frontier and the set of unvisited vertices
+		 * are bitsets, and each level is expanded by OR-ing the adjacency rows of the frontier
+		 * vertices, masked by the unvisited set, a word (or an AVX2/AVX-512 vector) at a time.
+		 *
+		 * The vector width is chosen at compile time from the target instruction set.
+		 * A compact_dense_graph is searched in place. Other graphs, including the byte-based
+		 * dense_graph, are first converted to a bit matrix, which takes O(V^2 / 64 + E) time.
+		 *
+		 * Complexity: O(V^2 / 64 + V) word operations
+		 */
+		template<graph GraphT>
+			requires graph_traits::has_natural_vertex_numbering_v<GraphT>
+		search_tree<GraphT> dense_bfs_tree(const GraphT& graph, vertex_id_t<GraphT> start) {
+			using vid_t = vertex_id_t<GraphT>;
+			using edge_type = edge_t<GraphT>;
+
+			search_tree<GraphT> result(graph);
+
+			decltype(auto) adj = detail::adjacency_bit_matrix(graph);
+			isize n = num_vertices(graph);
+			isize num_words = adj.words_per_row();
+
+			detail::bitset_storage unvisited(num_words, 0);
+			detail::bitset_storage frontier(num_words, 0);
+			detail::bitset_storage next(num_words, 0);
+			for(isize v=0; v<n; v++) {
+				unvisited[v / 64] |= detail::bitset_word(1) << (v % 64);
+			}
+
+			frontier[start / 64] |= detail::bitset_word(1) << (start % 64);
+			unvisited[start / 64] &= ~(detail::bitset_word(1) << (start % 64));
+			result.distances[start] = 0;
+
+			for(int level = 1; ; level++) {
+				for(auto u: g2x::detail::set_bit_indices(frontier)) {
+					detail::expand_frontier_row(adj.row_words(u).data(), unvisited.data(), next.data(), num_words, [&](isize v) {
+						result.distances[v] = level;
+						if constexpr(simplified_edge_value_c<edge_type>) {
+							result.source_edges[v] = edge_type{vid_t(u), vid_t(v)};
+						} else {
+							// edges with ids have to be looked up, which only happens once per vertex
+							for(const auto& e: outgoing_edges(graph, vid_t(u))) {
+								const auto& [eu, ev, ei] = e;
+								if(ev == vid_t(v)) {
+									result.source_edges[v] = e;
+									break;
+								}
+							}
+						}
+					});
+				}
+				if(not detail::retire_frontier(unvisited.data(), next.data(), num_words)) {
+					break;
+				}
+				std::swap(frontier, next);
+				std::ranges::fill(next, 0);
+			}
+
+			return result;
+		}
+
+	}
+
+}
+
+#endif //GRAPH2X_DENSE_BFS_HPP
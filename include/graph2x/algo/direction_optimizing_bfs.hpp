@@ -0,0 +1,130 @@
+
+#ifndef GRAPH2X_DIRECTION_OPTIMIZING_BFS_HPP
+#define GRAPH2X_DIRECTION_OPTIMIZING_BFS_HPP
+
+#include <vector>
+
+#include "../core.hpp"
+#include "search.hpp"
+
+namespace g2x {
+
+	namespace algo {
+
+		/*
+		 * Graphs that can be searched bottom-up, i.e. ones where the edges incoming
+		 * to a vertex can be listed: undirected graphs and digraphs with incoming_edges.
+		 */
+		template<typename GraphT>
+		concept bottom_up_searchable_graph = graph<GraphT> && (
+			not graph_traits::is_directed_v<GraphT>
+			|| requires(const GraphT& g, vertex_id_t<GraphT> v) {g.incoming_edges(v);}
+		);
+
+		/*
+		 * Tunables of the direction-switching heuristic (Beamer et al., 2012).
+		 *
+		 * The search switches from top-down to bottom-up when the frontier is growing and
+		 * the number of edges outgoing from the frontier exceeds (edges to check from
+		 * unvisited vertices) / alpha. It switches back when the frontier is shrinking
+		 * and has fewer than (number of vertices) / beta vertices.
+		 */
+		struct direction_optimizing_bfs_params {
+			double alpha = 14.0;
+			double beta = 24.0;
+		};
+
+		/*
+		 * Breadth-first search that expands each level either top-down (scanning the outgoing
+		 * edges of the frontier) or bottom-up (letting every unvisited vertex look for a parent
+		 * in the frontier among its incoming edges, stopping at the first one found).
+		 * Bottom-up steps skip most edge inspections in the middle levels of low-diameter graphs.
+		 *
+		 * The distances are the same as those of breadth_first_search. The source edges form
+		 * a valid BFS tree, though a vertex may be given a different parent of the same level.
+		 *
+		 * Complexity: O(V + E) per top-down level, O(V + E) worst case per bottom-up level
+		 */
+		template<bottom_up_searchable_graph GraphT>
+		search_tree<GraphT> direction_optimizing_bfs_tree(
+			const GraphT& graph,
+			vertex_id_t<GraphT> start,
+			const direction_optimizing_bfs_params& params = {}
+		) {
+			using vid_t = vertex_id_t<GraphT>;
+
+			search_tree<GraphT> result(graph);
+
+			isize n = num_vertices(graph);
+			isize unvisited_edges = 0;
+			for(const auto& v: all_vertices(graph)) {
+				unvisited_edges += outdegree(graph, v);
+			}
+
+			std::vector<vid_t> frontier{start};
+			std::vector<vid_t> next;
+			result.distances[start] = 0;
+			isize frontier_edges = outdegree(graph, start);
+			unvisited_edges -= frontier_edges;
+
+			bool bottom_up = false;
+			isize prev_frontier_size = 0;
+
+			for(int level = 1; not frontier.empty(); level++) {
+				isize frontier_size = std::ssize(frontier);
+				if(not bottom_up) {
+					bottom_up = frontier_size > prev_frontier_size
+						&& double(frontier_edges) > double(unvisited_edges) / params.alpha;
+				} else {
+					bottom_up = not (frontier_size < prev_frontier_size
+						&& double(frontier_size) < double(n) / params.beta);
+				}
+
+				next.clear();
+				isize next_edges = 0;
+				auto discover = [&](const vid_t& v, const auto& edge) {
+					result.distances[v] = level;
+					result.source_edges[v] = edge;
+					next.push_back(v);
+					isize deg = outdegree(graph, v);
+					next_edges += deg;
+					unvisited_edges -= deg;
+				};
+
+				if(bottom_up) {
+					for(const auto& v: all_vertices(graph)) {
+						if(result.distances[v] != -1) {
+							continue;
+						}
+						for(const auto& edge: incoming_edges(graph, v)) {
+							const auto& [u, w, i] = edge;
+							if(result.distances[u] == level - 1) {
+								discover(v, edge);
+								break;
+							}
+						}
+					}
+				} else {
+					for(const auto& u: frontier) {
+						for(const auto& edge: outgoing_edges(graph, u)) {
+							const auto& [eu, v, i] = edge;
+							if(result.distances[v] == -1) {
+								discover(v, edge);
+							}
+						}
+					}
+				}
+
+				prev_frontier_size = frontier_size;
+				frontier_edges = next_edges;
+				std::swap(frontier, next);
+			}
+
+			return result;
+		}
+
+	}
+
+}
+
+#endif //GRAPH2X_DIRECTION_OPTIMIZING_BFS_HPP
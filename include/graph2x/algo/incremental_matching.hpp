@@ -0,0 +1,268 @@
+
+#ifndef GRAPH2X_INCREMENTAL_MATCHING_HPP
+#define GRAPH2X_INCREMENTAL_MATCHING_HPP
+
+#include <map>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "../core.hpp"
+#include "bip_matchings.hpp"
+
+namespace g2x {
+
+	namespace algo {
+
+		/*
+		 * Maintains a maximum matching of a bipartite graph while edges are inserted into it and
+		 * removed from it through this object.
+		 *
+		 * An inserted edge can only enlarge the maximum matching through an augmenting path that
+		 * contains it, so one alternating search from each of its endpoints suffices. When a matched
+		 * edge is removed, both of its endpoints become free and any new augmenting path has to
+		 * start at one of them, which again takes at most two searches. The searches are
+		 * breadth-first and only explore the part of the graph that is reachable by alternating
+		 * paths, so small changes are usually repaired in near-constant time.
+		 *
+		 * The sides of the bipartition are kept up to date as well. An edge joining two components
+		 * flips the sides of one of them if necessary, and an edge that would create an odd cycle
+		 * is rejected with std::invalid_argument.
+		 *
+		 * Vertices are kept in hash maps, so vertices created after construction need no special
+		 * handling, but the graph must not be modified other than through this object.
+		 * The graph must be undirected, since the searches follow outgoing edges only.
+		 */
+		template<graph GraphT>
+			requires (not graph_traits::is_directed_v<GraphT>)
+		class incremental_bipartite_matching {
+		public:
+			using vertex_id_type = vertex_id_t<GraphT>;
+			using edge_id_type = edge_id_t<GraphT>;
+
+			explicit incremental_bipartite_matching(GraphT& graph)
+				: graph_(graph)
+			{
+				auto partitions = bipartite_decompose(graph_).value();
+				for(const auto& v: all_vertices(graph_)) {
+					sides_[v] = partitions[v];
+				}
+				auto matching = max_bipartite_matching(graph_);
+				for(const auto& [u, v, i]: all_edges(graph_)) {
+					if(matching[i]) {
+						set_mates(u, v, i);
+						++size_;
+					}
+				}
+			}
+
+			/*
+			 * Creates an edge in the underlying graph and updates the matching.
+			 * Throws std::invalid_argument if the edge would make the graph non-bipartite.
+			 */
+			edge_id_type create_edge(vertex_id_type u, vertex_id_type v)
+				requires graph_traits::supports_edge_creation_v<GraphT>
+			{
+				assign_sides(u, v);
+				auto [left, right] = sides_.at(u) == 0 ? std::pair{u, v} : std::pair{v, u};
+
+				// the searches run before the edge exists, so that they cannot use it
+				auto path_to_left = alternating_path_to_free(left, 0);
+				auto path_to_right = path_to_left ? alternating_path_to_free(right, 1) : std::nullopt;
+
+				auto eid = g2x::create_edge(graph_, u, v);
+				if(path_to_left && path_to_right) {
+					path_to_left->push_back(eid);
+					path_to_left->insert(path_to_left->end(), path_to_right->begin(), path_to_right->end());
+					augment(*path_to_left);
+				}
+				return eid;
+			}
+
+			/*
+			 * Removes an edge from the underlying graph and updates the matching.
+			 * Returns false if the graph has no such edge.
+			 */
+			bool remove_edge(edge_id_type eid)
+				requires graph_traits::supports_edge_deletion_v<GraphT>
+			{
+				// endpoints of matched edges are recorded, since edge_at may throw for unknown edges
+				auto matched_it = matched_edges_.find(eid);
+				if(not g2x::remove_edge(graph_, eid)) {
+					return false;
+				}
+				if(matched_it == matched_edges_.end()) {
+					return true;
+				}
+
+				const auto [u, v] = matched_it->second;
+				matched_edges_.erase(matched_it);
+				mates_.erase(u);
+				mates_.erase(v);
+				--size_;
+				for(const auto& endpoint: {u, v}) {
+					int target_side = 1 - sides_.at(endpoint);
+					if(auto path = alternating_path_to_free(endpoint, target_side)) {
+						augment(*path);
+						break;
+					}
+				}
+				return true;
+			}
+
+			[[nodiscard]] bool is_matched(edge_id_type eid) const {
+				return matched_edges_.contains(eid);
+			}
+
+			[[nodiscard]] std::optional<vertex_id_type> mate(vertex_id_type v) const {
+				if(auto it = mates_.find(v); it != mates_.end()) {
+					return it->second.first;
+				}
+				return std::nullopt;
+			}
+
+			// returns 0 or 1, like the labels of bipartite_decompose
+			[[nodiscard]] int side(vertex_id_type v) const {
+				return sides_.at(v);
+			}
+
+			[[nodiscard]] isize size() const {
+				return size_;
+			}
+
+			/*
+			 * Returns the current matching as an edge property, in the same form as max_bipartite_matching.
+			 */
+			[[nodiscard]] auto matching() const {
+				auto result = create_edge_property<boolean>(graph_, false);
+				for(const auto& [eid, endpoints]: matched_edges_) {
+					result[eid] = true;
+				}
+				return result;
+			}
+
+		private:
+
+			// edge ids are not hashable for every graph type, e.g. those of dense graphs are pairs
+			using matched_edge_map_type = std::conditional_t<
+				requires{std::unordered_map<edge_id_type, std::pair<vertex_id_type, vertex_id_type>>{};},
+				std::unordered_map<edge_id_type, std::pair<vertex_id_type, vertex_id_type>>,
+				std::map<edge_id_type, std::pair<vertex_id_type, vertex_id_type>>
+			>;
+
+			// matches u with v, unmatching the previous matched edges of both
+			void set_mates(vertex_id_type u, vertex_id_type v, edge_id_type eid) {
+				for(const auto& x: {u, v}) {
+					if(auto it = mates_.find(x); it != mates_.end()) {
+						matched_edges_.erase(it->second.second);
+					}
+				}
+				mates_[u] = {v, eid};
+				mates_[v] = {u, eid};
+				matched_edges_[eid] = {u, v};
+			}
+
+			/*
+			 * Assigns sides to the endpoints of a new edge. If both endpoints already have the same side,
+			 * the component of v is flipped, unless u is in the same component.
+			 */
+			void assign_sides(vertex_id_type u, vertex_id_type v) {
+				if(u == v) {
+					throw std::invalid_argument(std::format("loop ({}, {}) cannot be added to a bipartite graph", u, v));
+				}
+				auto u_it = sides_.find(u);
+				auto v_it = sides_.find(v);
+				if(u_it == sides_.end() && v_it == sides_.end()) {
+					sides_[u] = 0;
+					sides_[v] = 1;
+				} else if(v_it == sides_.end()) {
+					sides_[v] = 1 - u_it->second;
+				} else if(u_it == sides_.end()) {
+					sides_[u] = 1 - v_it->second;
+				} else if(u_it->second == v_it->second) {
+					std::vector<vertex_id_type> component {v};
+					std::unordered_map<vertex_id_type, boolean> visited {{v, true}};
+					for(std::size_t k=0; k<component.size(); k++) {
+						for(const auto& [x, y, i]: outgoing_edges(graph_, component[k])) {
+							if(y == u) {
+								throw std::invalid_argument(std::format("edge ({}, {}) would create an odd cycle", u, v));
+							}
+							if(not visited[y]) {
+								visited[y] = true;
+								component.push_back(y);
+							}
+						}
+					}
+					for(const auto& x: component) {
+						sides_[x] = 1 - sides_[x];
+					}
+				}
+			}
+
+			/*
+			 * Breadth-first search for an alternating path from "start" to a free vertex on the given side.
+			 * From vertices on the target side, the path continues through their matched edge, and
+			 * from the others through unmatched edges. Returns the ids of the edges of the path,
+			 * which is empty if "start" itself is a free vertex on the target side.
+			 */
+			std::optional<std::vector<edge_id_type>> alternating_path_to_free(vertex_id_type start, int target_side) {
+				std::vector<vertex_id_type> queue {start};
+				std::unordered_map<vertex_id_type, std::optional<std::pair<vertex_id_type, edge_id_type>>> source_edges {{start, std::nullopt}};
+
+				auto visit = [&](vertex_id_type from, vertex_id_type to, edge_id_type eid) {
+					if(source_edges.try_emplace(to, std::pair{from, eid}).second) {
+						queue.push_back(to);
+					}
+				};
+
+				for(std::size_t k=0; k<queue.size(); k++) {
+					auto x = queue[k];
+					auto mate_it = mates_.find(x);
+					if(sides_.at(x) == target_side) {
+						if(mate_it == mates_.end()) {
+							std::vector<edge_id_type> path;
+							for(auto src = source_edges.at(x); src; src = source_edges.at(src->first)) {
+								path.push_back(src->second);
+							}
+							std::ranges::reverse(path);
+							return path;
+						}
+						visit(x, mate_it->second.first, mate_it->second.second);
+					} else {
+						for(const auto& [x1, y, i]: outgoing_edges(graph_, x)) {
+							if(mate_it == mates_.end() || mate_it->second.second != i) {
+								visit(x, y, i);
+							}
+						}
+					}
+				}
+				return std::nullopt;
+			}
+
+			// flips the edges of an augmenting path, given as a sequence of edge ids
+			void augment(const std::vector<edge_id_type>& path) {
+				std::vector<edge_id_type> newly_matched;
+				for(const auto& eid: path) {
+					if(not is_matched(eid)) {
+						newly_matched.push_back(eid);
+					}
+				}
+				for(const auto& eid: newly_matched) {
+					const auto& [u, v, i] = edge_at(graph_, eid);
+					set_mates(u, v, eid);
+				}
+				++size_;
+			}
+
+			GraphT& graph_;
+			std::unordered_map<vertex_id_type, int> sides_;
+			std::unordered_map<vertex_id_type, std::pair<vertex_id_type, edge_id_type>> mates_;
+			matched_edge_map_type matched_edges_;
+			isize size_ = 0;
+		};
+
+	}
+
+}
+
+#endif //GRAPH2X_INCREMENTAL_MATCHING_HPP
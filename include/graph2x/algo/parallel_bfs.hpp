@@ -0,0 +1,142 @@
+
+#ifndef GRAPH2X_PARALLEL_BFS_HPP
+#define GRAPH2X_PARALLEL_BFS_HPP
+
+#include <atomic>
+#include <barrier>
+#include <exception>
+#include <vector>
+
+#include "../core.hpp"
+#include "../execution.hpp"
+#include "search.hpp"
+
+namespace g2x {
+
+	namespace algo {
+
+		namespace detail {
+
+			// number of frontier vertices claimed by a worker at a time
+			inline constexpr isize parallel_bfs_chunk_size = 256;
+
+			inline constexpr isize parallel_bfs_min_vertices_per_worker = 1 << 14;
+
+		}
+
+		/*
+		 * Level-synchronous parallel breadth-first search.
+		 *
+		 * The workers are started once and kept for the whole search. Each level, they claim
+		 * chunks of the frontier from a shared cursor, claim the vertices they discover by
+		 * a compare-and-swap on their distance and collect them in per-worker buffers,
+		 * which are then copied side by side into the next frontier.
+		 *
+		 * The distances are the same as those of breadth_first_search. Which of the parents
+		 * on the previous level becomes the source edge of a vertex depends on the scheduling.
+		 * If a worker throws, all workers stop at the end of the level and the first exception
+		 * is rethrown.
+		 *
+		 * Complexity: O((V + E) / P + D) time with P workers, where D is the depth of the search
+		 */
+		template<graph GraphT>
+			requires graph_traits::has_natural_vertex_numbering_v<GraphT>
+		search_tree<GraphT> parallel_bfs_tree(
+			const execution::execution_policy auto& policy,
+			const GraphT& graph,
+			vertex_id_t<GraphT> start
+		) {
+			using vid_t = vertex_id_t<GraphT>;
+
+			search_tree<GraphT> result(graph);
+
+			isize n = num_vertices(graph);
+			int num_workers = g2x::detail::num_workers_for(policy, n, detail::parallel_bfs_min_vertices_per_worker);
+
+			// reserved up front, so that the barrier completion steps never allocate
+			std::vector<vid_t> frontier;
+			std::vector<vid_t> next;
+			frontier.reserve(n);
+			next.reserve(n);
+			frontier.push_back(start);
+			result.distances[start] = 0;
+
+			std::vector<std::vector<vid_t>> local_next(num_workers);
+			std::vector<isize> local_offsets(num_workers + 1, 0);
+			std::atomic<isize> cursor = 0;
+			int level = 1;
+
+			auto merge_step = [&]() noexcept {
+				for(int w=0; w<num_workers; w++) {
+					local_offsets[w + 1] = local_offsets[w] + std::ssize(local_next[w]);
+				}
+				next.resize(local_offsets[num_workers]);
+			};
+			auto advance_step = [&]() noexcept {
+				std::swap(frontier, next);
+				cursor.store(0, std::memory_order_relaxed);
+				level++;
+			};
+			std::barrier expanded(num_workers, merge_step);
+			std::barrier merged(num_workers, advance_step);
+
+			// a worker that throws keeps arriving at the barriers until all workers have seen the flag
+			std::atomic<bool> stopped = false;
+			std::exception_ptr exception;
+
+			g2x::detail::run_workers(num_workers, [&](int w) {
+				auto& discovered = local_next[w];
+				while(not frontier.empty()) {
+					discovered.clear();
+					try {
+						isize frontier_size = std::ssize(frontier);
+						isize begin;
+						while(not stopped.load(std::memory_order_relaxed)
+							&& (begin = cursor.fetch_add(detail::parallel_bfs_chunk_size, std::memory_order_relaxed)) < frontier_size
+						) {
+							isize end = std::min(begin + detail::parallel_bfs_chunk_size, frontier_size);
+							for(isize k=begin; k<end; k++) {
+								for(const auto& edge: outgoing_edges(graph, frontier[k])) {
+									const auto& [u, v, i] = edge;
+									std::atomic_ref<int> distance(result.distances[v]);
+									int expected = -1;
+									if(distance.load(std::memory_order_relaxed) == -1
+										&& distance.compare_exchange_strong(expected, level, std::memory_order_relaxed)
+									) {
+										result.source_edges[v] = edge;
+										discovered.push_back(v);
+									}
+								}
+							}
+						}
+					} catch(...) {
+						if(not stopped.exchange(true)) {
+							exception = std::current_exception();
+						}
+					}
+					expanded.arrive_and_wait();
+					std::ranges::copy(discovered, next.begin() + local_offsets[w]);
+					merged.arrive_and_wait();
+					if(stopped.load()) {
+						break;
+					}
+				}
+			});
+
+			if(exception) {
+				std::rethrow_exception(exception);
+			}
+			return result;
+		}
+
+		template<graph GraphT>
+			requires graph_traits::has_natural_vertex_numbering_v<GraphT>
+		search_tree<GraphT> parallel_bfs_tree(const GraphT& graph, vertex_id_t<GraphT> start) {
+			return parallel_bfs_tree(execution::par, graph, start);
+		}
+
+	}
+
+}
+
+#endif //GRAPH2X_PARALLEL_BFS_HPP
@@ -2,6 +2,8 @@
 #ifndef GRAPH2X_SEARCH_HPP_E65AC38138DD4840A7A8E07996A89616
 #define GRAPH2X_SEARCH_HPP_E65AC38138DD4840A7A8E07996A89616
 
+#include <cstdint>
+#include <limits>
 #include <vector>
 #include "../core.hpp"
 #include "../util.hpp"
@@ -61,6 +63,10 @@ namespace g2x {
 				storage.resize(0);
 				tail = 0;
 			}
+
+			void discard_pending() {
+				storage.resize(tail);
+			}
 		private:
 			std::vector<vertex_type> storage;
 			size_t tail = 0;
@@ -109,6 +115,10 @@ namespace g2x {
 				storage_stack.resize(0);
 				storage_popped.resize(0);
 			}
+
+			void discard_pending() {
+				storage_stack.resize(0);
+			}
 		private:
 			std::vector<vertex_type> storage_stack;
 			std::vector<vertex_type> storage_popped;
@@ -123,6 +133,7 @@ namespace g2x {
 			{x.pending_items()} -> std::ranges::range;
 			{x.processed_items()} -> std::ranges::range;
 			{x.reset()};
+			{x.discard_pending()};
 		};
 		
 		template<
@@ -148,7 +159,7 @@ namespace g2x {
 			)
 				: graph_(graph),
 				  search_structure_(),
-				  state_container_(create_vertex_property(graph, vertex_search_state::unvisited)),
+				  state_container_(create_vertex_property(graph, stamp_type{0})),
 				  source_edge_container_(create_vertex_property<edge_opt>(graph)),
 				  edge_predicate_(std::forward<EdgePredicateRefT>(edge_predicate)),
 				  vertex_predicate_(std::forward<VertexPredicateRefT>(vertex_predicate)),
@@ -165,7 +176,8 @@ namespace g2x {
 					throw std::runtime_error("cannot add a marked/visited vertex for searching");
 				}
 				search_structure_.push(v);
-				state_container_.at(v) = vertex_search_state::marked;
+				state_container_[v] = generation_;
+				source_edge_container_[v] = std::nullopt;
 			}
 			
 			std::optional<vertex_id_type> next_vertex() {
@@ -173,7 +185,7 @@ namespace g2x {
 					return std::nullopt;
 				}
 				auto vtx = search_structure_.pop();
-				state_container_[vtx] = vertex_search_state::visited;
+				state_container_[vtx] = generation_ + 1;
 				auto&& outgoing_edges_view = outgoing_edges(this->graph_, vtx);
 				for(const auto& edge: adjacency_projection_(outgoing_edges_view)) {
 					const auto& [u, v, i] = edge;
@@ -189,11 +201,16 @@ namespace g2x {
 			}
 			
 			[[nodiscard]] vertex_search_state get_vertex_state(const vertex_id_type& v) const {
+				stamp_type stamp;
 				if constexpr(requires{state_container_[v];}) {
-					return state_container_[v];
+					stamp = state_container_[v];
 				} else {
-					return state_container_.at(v);
+					stamp = state_container_.at(v);
+				}
+				if(stamp < generation_) {
+					return vertex_search_state::unvisited;
 				}
+				return stamp == generation_ ? vertex_search_state::marked : vertex_search_state::visited;
 			}
 			
 			std::optional<edge_type> next_edge() {
@@ -218,6 +235,9 @@ namespace g2x {
 			}
 			
 			std::optional<edge_type> source_edge(const vertex_id_type& v) {
+				if(get_vertex_state(v) == vertex_search_state::unvisited) {
+					return std::nullopt; // left over from an earlier search
+				}
 				return source_edge_container_[v];
 			}
 			
@@ -234,34 +254,48 @@ namespace g2x {
 				}
 			}
 
+			/*
+			 * Makes every vertex unvisited again in O(1) time, by starting a new generation
+			 * of states. The states are only cleared when the generations run out.
+			 */
 			void reset() {
-
-				int full_reset_threshold = num_vertices(graph_) / 4;
-				if(std::ranges::size(search_structure_.processed_items()) > full_reset_threshold) {
-					std::ranges::fill(state_container_, vertex_search_state::unvisited);
-					std::ranges::fill(source_edge_container_, edge_opt{});
+				if(generation_ > std::numeric_limits<stamp_type>::max() - 4) {
+					state_container_ = create_vertex_property(graph_, stamp_type{0});
+					generation_ = 1;
 				} else {
-					for(const auto& v: search_structure_.pending_items()) {
-						state_container_[v] = vertex_search_state::unvisited;
-					}
-					for(const auto& v: search_structure_.processed_items()) {
-						state_container_[v] = vertex_search_state::unvisited;
-						source_edge_container_[v] = std::nullopt;
-					}
+					generation_ += 2;
 				}
-
 				search_structure_.reset();
 			}
 
+			/*
+			 * Drops the vertices that are waiting to be visited, making them unvisited again,
+			 * but keeps the state of the visited ones. This lets several searches share the set
+			 * of visited vertices, e.g. within a phase of an augmenting path algorithm.
+			 */
+			void discard_pending() {
+				for(const auto& v: search_structure_.pending_items()) {
+					state_container_[v] = 0;
+				}
+				search_structure_.discard_pending();
+			}
+
 			void expect_up_to(int num_vertices) {
 				search_structure_.expect_up_to(num_vertices);
 			}
 		
 		private:
 			
+			/*
+			 * The state of a vertex is stamped with the generation of the search that set it:
+			 * a stamp below generation_ means unvisited, generation_ means marked and
+			 * generation_ + 1 means visited.
+			 */
+			using stamp_type = std::uint32_t;
+
 			using edge_opt = std::optional<edge_type>;
 			using edge_container_type = decltype(create_vertex_property<edge_opt, GraphT>(std::declval<GraphT>()));
-			using state_container_type = decltype(create_vertex_property<vertex_search_state, GraphT>(std::declval<GraphT>()));
+			using state_container_type = decltype(create_vertex_property<stamp_type, GraphT>(std::declval<GraphT>()));
 
 			using edge_predicate_type = std::remove_cvref_t<EdgePredicateRefT>;
 			using vertex_predicate_type = std::remove_cvref_t<VertexPredicateRefT>;
@@ -273,6 +307,7 @@ namespace g2x {
 
 			edge_container_type source_edge_container_;
 			state_container_type state_container_;
+			stamp_type generation_ = 1;
 
 			edge_predicate_type edge_predicate_;
 			vertex_predicate_type vertex_predicate_;
@@ -308,6 +343,42 @@ namespace g2x {
 		}
 		
 		
+		/*
+		 * The result of a single-source search: the distance of each vertex from the source
+		 * (-1 for unreachable vertices) and the edge through which each vertex was reached.
+		 */
+		template<graph GraphT>
+		struct search_tree {
+			using edge_opt = std::optional<edge_t<GraphT>>;
+			using distance_container_type = decltype(create_vertex_property<int, GraphT>(std::declval<GraphT>()));
+			using source_edge_container_type = decltype(create_vertex_property<edge_opt, GraphT>(std::declval<GraphT>()));
+
+			distance_container_type distances;
+			source_edge_container_type source_edges;
+
+			explicit search_tree(const GraphT& graph)
+				: distances(create_vertex_property(graph, -1)),
+				  source_edges(create_vertex_property(graph, edge_opt{}))
+			{}
+		};
+
+		/*
+		 * Computes a breadth-first search tree with generic_graph_search. This is the reference
+		 * for the specialized BFS engines, which produce results of the same form.
+		 */
+		template<graph GraphT>
+		search_tree<GraphT> bfs_tree(const GraphT& graph, vertex_id_t<GraphT> start) {
+			search_tree<GraphT> result(graph);
+			breadth_first_search bfs(graph);
+			bfs.expect_up_to(num_vertices(graph));
+			bfs.add_vertex(start);
+			while(auto vtx = bfs.next_vertex()) {
+				bfs.update_distances(*vtx, result.distances);
+				result.source_edges[*vtx] = bfs.source_edge(*vtx);
+			}
+			return result;
+		}
+
 		template<graph GraphT, typename IdxOrRangeT>
 		auto simple_edges_bfs(const GraphT& graph, IdxOrRangeT&& start = {}) {
 			breadth_first_search bfs(graph);
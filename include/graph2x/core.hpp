@@ -12,6 +12,9 @@
 #include <ostream>
 #include <vector>
 #include <print>
+#include <optional>
+
+#include "execution.hpp"
 
 namespace g2x {
 
@@ -882,6 +885,9 @@ namespace g2x {
 
 
 
+	using vertex_count = std::optional<int>;
+	inline constexpr vertex_count auto_num_vertices = std::nullopt;
+
 	template<typename GraphT>
 	auto create_graph(std::ranges::forward_range auto&& edge_range) {
 		if constexpr (requires {GraphT(edge_range);}) {
@@ -889,7 +895,7 @@ namespace g2x {
 		} else {
 			vertex_id_t<GraphT> max_v {};
 			for(const auto& [u, v]: edge_range) {
-				max_v = std::max<vertex_id_t<GraphT>>(max_v, v+1);
+				max_v = std::max<vertex_id_t<GraphT>>({max_v, vertex_id_t<GraphT>(u+1), vertex_id_t<GraphT>(v+1)});
 			}
 			return GraphT{max_v, std::forward<decltype(edge_range)>(edge_range)};
 		}
@@ -918,8 +924,34 @@ namespace g2x {
 		);
 	}
 
-	using vertex_count = std::optional<int>;
-	inline constexpr vertex_count auto_num_vertices = std::nullopt;
+	/*
+	 * Like create_graph(num_vertices, edge_range), but lets graph types that support it
+	 * use multiple threads during construction (see g2x::execution). Other graph types
+	 * are constructed sequentially.
+	 */
+	template<typename GraphT>
+	auto create_graph(const execution::execution_policy auto& policy, isize num_vertices, std::ranges::forward_range auto&& edge_range) {
+		if constexpr (requires {GraphT(policy, num_vertices, edge_range);}) {
+			return GraphT{policy, num_vertices, std::forward<decltype(edge_range)>(edge_range)};
+		} else {
+			return create_graph<GraphT>(num_vertices, std::forward<decltype(edge_range)>(edge_range));
+		}
+	}
+
+	/*
+	 * Like create_graph(edge_range), but lets graph types that support it
+	 * use multiple threads during construction (see g2x::execution).
+	 */
+	template<typename GraphT>
+	auto create_graph(const execution::execution_policy auto& policy, std::ranges::forward_range auto&& edge_range) {
+		if constexpr (requires {GraphT(policy, edge_range);}) {
+			return GraphT{policy, std::forward<decltype(edge_range)>(edge_range)};
+		} else if constexpr (requires {GraphT(policy, auto_num_vertices, edge_range);}) {
+			return GraphT{policy, auto_num_vertices, std::forward<decltype(edge_range)>(edge_range)};
+		} else {
+			return create_graph<GraphT>(std::forward<decltype(edge_range)>(edge_range));
+		}
+	}
 
 }
 
@@ -0,0 +1,134 @@
+
+#ifndef GRAPH2X_EXECUTION_HPP
+#define GRAPH2X_EXECUTION_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace g2x {
+
+	namespace execution {
+
+		/*
+		 * Execution policies accepted by the parallel-capable parts of the library.
+		 *
+		 * These are distinct from the std::execution policies: the library spawns its own
+		 * threads instead of relying on the standard library's parallel algorithms, which
+		 * are not available on every implementation without additional dependencies.
+		 */
+
+		struct sequenced_policy {
+			[[nodiscard]] int concurrency() const {
+				return 1;
+			}
+		};
+
+		struct parallel_policy {
+			// 0 selects std::thread::hardware_concurrency()
+			int num_threads = 0;
+
+			[[nodiscard]] parallel_policy operator()(int threads) const {
+				return parallel_policy{threads};
+			}
+
+			[[nodiscard]] int concurrency() const {
+				if(num_threads > 0) {
+					return num_threads;
+				}
+				return std::max(1, int(std::thread::hardware_concurrency()));
+			}
+		};
+
+		inline constexpr sequenced_policy seq {};
+		inline constexpr parallel_policy par {};
+
+		template<typename T>
+		concept execution_policy =
+			   std::same_as<std::remove_cvref_t<T>, sequenced_policy>
+			|| std::same_as<std::remove_cvref_t<T>, parallel_policy>;
+
+	}
+
+	namespace detail {
+
+		/*
+		 * Calls fn(worker_index) on num_workers threads, the calling thread being worker 0.
+		 * The first exception thrown by any worker is rethrown after all of them have finished.
+		 */
+		void run_workers(int num_workers, auto&& fn) {
+			if(num_workers <= 1) {
+				fn(0);
+				return;
+			}
+
+			std::exception_ptr first_exception;
+			std::mutex exception_mtx;
+
+			auto guarded_fn = [&](int worker_index) {
+				try {
+					fn(worker_index);
+				} catch(...) {
+					std::scoped_lock lk {exception_mtx};
+					if(not first_exception) {
+						first_exception = std::current_exception();
+					}
+				}
+			};
+
+			{
+				std::vector<std::jthread> threads;
+				threads.reserve(num_workers - 1);
+				for(int w=1; w<num_workers; w++) {
+					threads.emplace_back(guarded_fn, w);
+				}
+				guarded_fn(0);
+			}
+
+			if(first_exception) {
+				std::rethrow_exception(first_exception);
+			}
+		}
+
+		/*
+		 * Returns the bounds of the chunk_index-th of num_chunks nearly equal parts of [0; num_items).
+		 */
+		inline std::pair<std::ptrdiff_t, std::ptrdiff_t> chunk_bounds(std::ptrdiff_t num_items, int num_chunks, int chunk_index) {
+			return {
+				num_items * chunk_index / num_chunks,
+				num_items * (chunk_index + 1) / num_chunks
+			};
+		}
+
+		/*
+		 * Splits [0; num_items) into num_chunks contiguous chunks and calls fn(chunk_index, begin, end)
+		 * for each of them on a separate thread. The split only depends on the arguments, so calls
+		 * with equal arguments visit equal chunks.
+		 */
+		void parallel_for_chunks(int num_chunks, std::ptrdiff_t num_items, auto&& fn) {
+			run_workers(num_chunks, [&](int chunk_index) {
+				auto [begin, end] = chunk_bounds(num_items, num_chunks, chunk_index);
+				fn(chunk_index, begin, end);
+			});
+		}
+
+		/*
+		 * Picks the number of workers for processing num_items items under a given policy,
+		 * so that no worker gets fewer than min_items_per_worker items.
+		 */
+		inline int num_workers_for(const execution::execution_policy auto& policy, std::ptrdiff_t num_items, std::ptrdiff_t min_items_per_worker) {
+			auto max_useful = std::max<std::ptrdiff_t>(1, num_items / std::max<std::ptrdiff_t>(1, min_items_per_worker));
+			return int(std::min<std::ptrdiff_t>(policy.concurrency(), max_useful));
+		}
+
+	}
+
+}
+
+#endif //GRAPH2X_EXECUTION_HPP
@@ -3,6 +3,8 @@
 #define GRAPH2X_STATIC_SIMPLE_GRAPH_HPP
 
 #include <algorithm>
+#include <limits>
+#include <utility>
 #include <vector>
 #include <span>
 #include <set>
@@ -11,11 +13,278 @@
 
 
 namespace g2x {
+
+	namespace detail {
+
+		/*
+		 * Stable counting sort of "input" into "output" (which must be of the same size) by a key
+		 * in the range [0; num_keys). On return, regions[k] is the index of the first element of "output"
+		 * with key k, and regions[num_keys] is equal to the number of elements.
+		 *
+		 * With num_chunks > 1, the input is split into that many chunks, each of which gets its own
+		 * histogram and is scattered by a separate thread. The result is identical to the sequential one.
+		 * This requires O(num_chunks * num_keys) additional memory.
+		 */
+		template<typename T, typename OffsetT>
+		void counting_sort_by_key(
+			const std::vector<T>& input,
+			std::vector<T>& output,
+			std::vector<OffsetT>& regions,
+			isize num_keys,
+			auto&& key,
+			int num_chunks = 1)
+		{
+			if(num_chunks <= 1) {
+				regions.assign(num_keys + 1, 0);
+				for(const auto& x: input) {
+					++regions[key(x) + 1];
+				}
+				for(isize k=0; k<num_keys; k++) {
+					regions[k+1] += regions[k];
+				}
+
+				std::vector<OffsetT> cursors(regions.begin(), regions.end() - 1);
+				for(const auto& x: input) {
+					output[cursors[key(x)]++] = x;
+				}
+				return;
+			}
+
+			isize num_items = input.size();
+
+			std::vector<std::vector<OffsetT>> histograms(num_chunks);
+			parallel_for_chunks(num_chunks, num_items, [&](int chunk, isize begin, isize end) {
+				auto& histogram = histograms[chunk];
+				histogram.assign(num_keys, 0);
+				for(isize i=begin; i<end; i++) {
+					++histogram[key(input[i])];
+				}
+			});
+
+			// prefix sum over (key, chunk) pairs in key-major order, computed per key range:
+			// first the totals of each range, then the offsets within each range
+			std::vector<OffsetT> key_range_offsets(num_chunks + 1, 0);
+			parallel_for_chunks(num_chunks, num_keys, [&](int key_range, isize begin, isize end) {
+				OffsetT total = 0;
+				for(isize k=begin; k<end; k++) {
+					for(const auto& histogram: histograms) {
+						total += histogram[k];
+					}
+				}
+				key_range_offsets[key_range + 1] = total;
+			});
+			for(int r=0; r<num_chunks; r++) {
+				key_range_offsets[r+1] += key_range_offsets[r];
+			}
+
+			regions.resize(num_keys + 1);
+			regions[num_keys] = num_items;
+			parallel_for_chunks(num_chunks, num_keys, [&](int key_range, isize begin, isize end) {
+				OffsetT running = key_range_offsets[key_range];
+				for(isize k=begin; k<end; k++) {
+					regions[k] = running;
+					for(auto& histogram: histograms) {
+						running += std::exchange(histogram[k], running);
+					}
+				}
+			});
+
+			// each histogram now holds the output cursors of its chunk
+			parallel_for_chunks(num_chunks, num_items, [&](int chunk, isize begin, isize end) {
+				auto& cursors = histograms[chunk];
+				for(isize i=begin; i<end; i++) {
+					output[cursors[key(input[i])]++] = input[i];
+				}
+			});
+		}
+
+		/*
+		 * Helpers for building compressed sparse row adjacency, shared by the CSR-based graph types.
+		 */
+
+		// below this many half-edges per thread, parallel construction is not worth the overhead
+		inline constexpr isize csr_min_half_edges_per_thread = 1 << 16;
+
+		template<typename EdgeValueT>
+		struct csr_half_edge_list {
+			std::vector<EdgeValueT> half_edges;
+			typename EdgeValueT::edge_id_type num_edges = 0;
+			isize counted_num_vertices = 0;
+		};
+
+		// whether a half-edge is the one representing its edge in edge index lookups
+		template<typename EdgeValueT>
+		[[nodiscard]] bool is_representative_half_edge(const EdgeValueT& e) {
+			if constexpr(EdgeValueT::is_directed) {
+				return true;
+			}
+			return e.u <= e.v;
+		}
+
+		/*
+		 * Checks the endpoints of an input edge. Without a given number of vertices, only
+		 * negative indices are invalid.
+		 */
+		inline void validate_csr_edge(vertex_count num_vertices, auto vtx1, auto vtx2) {
+			if(num_vertices.has_value()) {
+				if(vtx1 < 0 || vtx2 < 0 || vtx1 >= num_vertices.value() || vtx2 >= num_vertices.value()) {
+					throw std::out_of_range(std::format("vertex indices ({}, {}) out of range: [{}; {})", vtx1, vtx2, 0, num_vertices.value()));
+				}
+			} else if(vtx1 < 0 || vtx2 < 0) {
+				throw std::out_of_range(std::format("vertex indices ({}, {}) out of range: must not be negative", vtx1, vtx2));
+			}
+		}
+
+		// the ids of num_edges edges are [0; num_edges), so at most max(EIdxT) edges are allowed
+		template<typename EIdxT>
+		void validate_csr_num_edges(isize num_edges) {
+			if(std::cmp_greater(num_edges, std::numeric_limits<EIdxT>::max())) {
+				throw std::out_of_range(std::format("Limit of {} edges exceeded", std::numeric_limits<EIdxT>::max()));
+			}
+		}
+
+		template<typename EdgeValueT>
+		csr_half_edge_list<EdgeValueT> collect_csr_half_edges(vertex_count num_vertices, auto&& edges) {
+			using vertex_id_type = typename EdgeValueT::vertex_id_type;
+			using edge_id_type = typename EdgeValueT::edge_id_type;
+			static constexpr bool is_directed = EdgeValueT::is_directed;
+
+			csr_half_edge_list<EdgeValueT> result;
+			auto& [half_edges, num_edges, counted_num_vertices] = result;
+
+			if constexpr(std::ranges::sized_range<std::remove_cvref_t<decltype(edges)>>) {
+				half_edges.reserve(std::ranges::size(edges) * (is_directed ? 1 : 2));
+			}
+
+			for(const auto& [vtx1, vtx2]: edges) {
+				validate_csr_num_edges<edge_id_type>(isize(num_edges) + 1);
+				validate_csr_edge(num_vertices, vtx1, vtx2);
+
+				counted_num_vertices = std::max<isize>(counted_num_vertices, std::max<isize>(vtx1, vtx2) + 1);
+
+				half_edges.push_back({vertex_id_type(vtx1), vertex_id_type(vtx2), num_edges});
+				if(not is_directed && vtx1 != vtx2) {
+					half_edges.push_back({vertex_id_type(vtx2), vertex_id_type(vtx1), num_edges});
+				}
+				++num_edges;
+			}
+			return result;
+		}
+
+		/*
+		 * Like collect_csr_half_edges, but splits the input into chunks that are validated and
+		 * copied by separate threads. Half-edges end up in the same order as in the sequential case.
+		 */
+		template<typename EdgeValueT>
+		csr_half_edge_list<EdgeValueT> collect_csr_half_edges(int num_chunks, vertex_count num_vertices, auto&& edges) {
+			using vertex_id_type = typename EdgeValueT::vertex_id_type;
+			using edge_id_type = typename EdgeValueT::edge_id_type;
+			static constexpr bool is_directed = EdgeValueT::is_directed;
+
+			isize num_input_edges = std::ranges::size(edges);
+			validate_csr_num_edges<edge_id_type>(num_input_edges);
+
+			auto input_begin = std::ranges::begin(edges);
+
+			// first pass: validate, count half-edges and vertices in each chunk
+			std::vector<isize> chunk_offsets(num_chunks + 1, 0);
+			std::vector<isize> chunk_num_vertices(num_chunks, 0);
+			parallel_for_chunks(num_chunks, num_input_edges, [&](int chunk, isize begin, isize end) {
+				isize num_half_edges = 0;
+				isize counted_num_vertices = 0;
+				for(isize k=begin; k<end; k++) {
+					const auto& [vtx1, vtx2] = input_begin[k];
+					validate_csr_edge(num_vertices, vtx1, vtx2);
+					counted_num_vertices = std::max<isize>(counted_num_vertices, std::max<isize>(vtx1, vtx2) + 1);
+					num_half_edges += (not is_directed && vtx1 != vtx2) ? 2 : 1;
+				}
+				chunk_offsets[chunk + 1] = num_half_edges;
+				chunk_num_vertices[chunk] = counted_num_vertices;
+			});
+			for(int c=0; c<num_chunks; c++) {
+				chunk_offsets[c+1] += chunk_offsets[c];
+			}
+
+			csr_half_edge_list<EdgeValueT> result;
+			result.num_edges = num_input_edges;
+			result.counted_num_vertices = std::ranges::max(chunk_num_vertices);
+			result.half_edges.resize(chunk_offsets.back());
+
+			// second pass: write the half-edges of each chunk at its offset
+			parallel_for_chunks(num_chunks, num_input_edges, [&](int chunk, isize begin, isize end) {
+				isize out = chunk_offsets[chunk];
+				for(isize k=begin; k<end; k++) {
+					const auto& [vtx1, vtx2] = input_begin[k];
+					result.half_edges[out++] = {vertex_id_type(vtx1), vertex_id_type(vtx2), edge_id_type(k)};
+					if(not is_directed && vtx1 != vtx2) {
+						result.half_edges[out++] = {vertex_id_type(vtx2), vertex_id_type(vtx1), edge_id_type(k)};
+					}
+				}
+			});
+			return result;
+		}
+
+		/*
+		 * Collects the half-edges of an edge range, using multiple threads if the policy allows it
+		 * and "edges" is a sized random-access range.
+		 */
+		template<typename EdgeValueT>
+		csr_half_edge_list<EdgeValueT> collect_csr_half_edges(
+			const execution::execution_policy auto& policy,
+			vertex_count num_vertices,
+			auto&& edges)
+		{
+			using range_type = std::remove_cvref_t<decltype(edges)>;
+			if constexpr(std::ranges::random_access_range<range_type> && std::ranges::sized_range<range_type>) {
+				int num_chunks = num_workers_for(policy, std::ranges::size(edges), csr_min_half_edges_per_thread);
+				if(num_chunks > 1) {
+					return collect_csr_half_edges<EdgeValueT>(num_chunks, num_vertices, edges);
+				}
+			}
+			return collect_csr_half_edges<EdgeValueT>(num_vertices, edges);
+		}
+
+		/*
+		 * Sorts the half-edges by (u, v, i) in place and computes the adjacency regions.
+		 * Returns the number of vertices of the graph.
+		 *
+		 * Two stable counting sort passes (by target, then by source) yield this order, since
+		 * half-edges are collected in order of increasing i. The second pass yields the adjacency
+		 * regions as a by-product.
+		 */
+		template<typename EdgeValueT, typename OffsetT>
+		isize sort_csr_half_edges(
+			int num_chunks,
+			vertex_count num_vertices,
+			csr_half_edge_list<EdgeValueT>& list,
+			std::vector<OffsetT>& adjacency_regions)
+		{
+			using vertex_id_type = typename EdgeValueT::vertex_id_type;
+
+			isize result_num_vertices = num_vertices.value_or(list.counted_num_vertices);
+
+			if(result_num_vertices >= std::numeric_limits<vertex_id_type>::max()) {
+				throw std::out_of_range(std::format("Cannot create adjacency regions: limit of {} vertices exceeded", result_num_vertices-1));
+			}
+
+			std::vector<EdgeValueT> target_sorted_edges(list.half_edges.size());
+			std::vector<OffsetT> target_regions;
+			counting_sort_by_key(list.half_edges, target_sorted_edges, target_regions, result_num_vertices, [](const EdgeValueT& e) {
+				return e.v;
+			}, num_chunks);
+			counting_sort_by_key(target_sorted_edges, list.half_edges, adjacency_regions, result_num_vertices, [](const EdgeValueT& e) {
+				return e.u;
+			}, num_chunks);
+
+			return result_num_vertices;
+		}
+
+	}
 	
 	/*
 	 * An immutable graph.
 	 *
-	 * Creation: O(V + E*log(E))
+	 * Creation: O(V + E), multithreaded with execution::par
 	 * Adjacency check: O(log(N(v)))
 	 * Pass over outgoing_edges: O(N(v))
 	 * Pass over adjacent_vertices: O(N(v))
@@ -56,81 +325,37 @@ namespace g2x {
 			return {adjacency_regions.at(v), adjacency_regions.at(v+1)};
 		}
 
-		[[nodiscard]] bool is_edge_unique(edge_value_type e) const {
-			if constexpr(is_directed) {
-				return true;
-			}
-			return e.u <= e.v;
-		}
-	
 	public:
 		
-		general_basic_graph(vertex_count num_vertices, std::ranges::forward_range auto&& edges) {
-
-			isize counted_num_vertices = 0;
-
-			edge_id_type num_edges = 0;
-
-			if constexpr(std::ranges::sized_range<std::remove_cvref_t<decltype(edges)>>) {
-				edge_storage.reserve(std::ranges::size(edges));
-			}
-
-			for(const auto& [vtx1, vtx2]: edges) {
-				if(num_edges == std::numeric_limits<decltype(num_edges)>::max()) {
-					throw std::out_of_range(std::format("Limit of {} edges exceeded", num_edges));
-				}
+		general_basic_graph(vertex_count num_vertices, std::ranges::forward_range auto&& edges)
+			: general_basic_graph(execution::seq, num_vertices, std::forward<decltype(edges)>(edges))
+		{
 
-				bool idx_out_of_bound = false;
-				if(vtx1 < 0 || vtx2 < 0) {
-					idx_out_of_bound = true;
-				}
-				if(num_vertices.has_value() && (vtx1 >= num_vertices.value() || vtx2 >= num_vertices.value())) {
-					idx_out_of_bound = true;
-				}
-				if(idx_out_of_bound) {
-					throw std::out_of_range(std::format("vertex indices ({}, {}) out of range: [{}; {})", vtx1, vtx2, 0, num_vertices.value_or(counted_num_vertices)));
-				}
-
-				counted_num_vertices = std::max<isize>(counted_num_vertices, std::max(vtx1, vtx2));
+		}
 
-				edge_storage.push_back({EIdxT(vtx1), EIdxT(vtx2), num_edges});
-				if(not IsDirected && vtx1 != vtx2) {
-					edge_storage.push_back({EIdxT(vtx2), EIdxT(vtx1), num_edges});
+		/*
+		 * With a parallel execution policy, all construction steps after reading the input are multithreaded.
+		 * Reading the input is multithreaded as well if "edges" is a sized random-access range.
+		 */
+		general_basic_graph(
+			const execution::execution_policy auto& policy,
+			vertex_count num_vertices,
+			std::ranges::forward_range auto&& edges)
+		{
+			auto list = detail::collect_csr_half_edges<edge_value_type>(policy, num_vertices, edges);
+			int num_chunks = detail::num_workers_for(policy, list.half_edges.size(), detail::csr_min_half_edges_per_thread);
+
+			num_vertices_ = detail::sort_csr_half_edges(num_chunks, num_vertices, list, adjacency_regions);
+			edge_storage = std::move(list.half_edges);
+
+			offset_of_edge.resize(list.num_edges);
+			detail::parallel_for_chunks(num_chunks, edge_storage.size(), [&](int, isize begin, isize end) {
+				for(isize i=begin; i<end; i++) {
+					if(detail::is_representative_half_edge(edge_storage[i])) {
+						offset_of_edge[edge_storage[i].i] = i;
+					}
 				}
-				++num_edges;
-			}
-			std::sort(edge_storage.begin(), edge_storage.end(), [](auto&& e1, auto&& e2) {
-				const auto& [u1, v1, i1] = e1;
-				const auto& [u2, v2, i2] = e2;
-				return std::make_tuple(u1, v1, i1) < std::make_tuple(u2, v2, i2);
 			});
-
-			this->num_vertices_ = num_vertices.value_or(counted_num_vertices);
-
-			offset_of_edge.resize(num_edges);
-			for(isize i=edge_storage.size()-1; i>=0; i--) {
-				offset_of_edge[edge_storage[i].i] = i;
-			}
-
-			if(this->num_vertices_ >= std::numeric_limits<vertex_id_type>::max()) {
-				throw std::out_of_range(std::format("Cannot create adjacency regions: limit of {} vertices exceeded", num_vertices_-1));
-			}
-			
-
-			adjacency_regions.resize(this->num_vertices_ + 1);
-			adjacency_regions.front() = 0;
-			adjacency_regions.back() = edge_storage.size();
-			for(isize v=0; v<num_vertices_; v++) {
-				if(v > 0) {
-					adjacency_regions[v] = adjacency_regions[v-1];
-				}
-				auto& i = adjacency_regions[v];
-				while(i < edge_storage.size() && edge_storage[i].u < v) {
-					i++;
-				}
-			}
-			
-			
 		}
 		
 		[[nodiscard]] isize num_vertices() const {
@@ -160,6 +385,22 @@ namespace g2x {
 				| std::views::transform([this](edge_id_type e) {return edge_at(e);});
 		}
 
+		/*
+		 * Read-only views of the underlying CSR arrays, e.g. for serialization.
+		 */
+
+		[[nodiscard]] std::span<const edge_value_type> raw_edge_storage() const {
+			return edge_storage;
+		}
+
+		[[nodiscard]] std::span<const edge_offset_type> raw_adjacency_regions() const {
+			return adjacency_regions;
+		}
+
+		[[nodiscard]] std::span<const edge_offset_type> raw_offset_of_edge() const {
+			return offset_of_edge;
+		}
+
 	};
 
 	template<typename VIdxT, typename EIdxT = int>
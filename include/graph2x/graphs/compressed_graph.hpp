@@ -0,0 +1,370 @@
+
+#ifndef GRAPH2X_COMPRESSED_GRAPH_HPP
+#define GRAPH2X_COMPRESSED_GRAPH_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+#include "../core.hpp"
+#include "basic_graph.hpp"
+
+
+namespace g2x {
+
+	namespace detail {
+
+		[[nodiscard]] inline std::uint64_t zigzag_encode(std::int64_t x) {
+			return (std::uint64_t(x) << 1) ^ std::uint64_t(x >> 63);
+		}
+
+		[[nodiscard]] inline std::int64_t zigzag_decode(std::uint64_t x) {
+			return std::int64_t(x >> 1) ^ -std::int64_t(x & 1);
+		}
+
+		[[nodiscard]] inline int varint_size(std::uint64_t x) {
+			int size = 1;
+			while(x >= 0x80) {
+				x >>= 7;
+				++size;
+			}
+			return size;
+		}
+
+		inline void write_varint(std::uint8_t*& out, std::uint64_t x) {
+			while(x >= 0x80) {
+				*out++ = std::uint8_t(x | 0x80);
+				x >>= 7;
+			}
+			*out++ = std::uint8_t(x);
+		}
+
+		[[nodiscard]] inline std::uint64_t read_varint(const std::uint8_t*& in) {
+			std::uint64_t result = 0;
+			int shift = 0;
+			while(*in & 0x80) {
+				result |= std::uint64_t(*in++ & 0x7F) << shift;
+				shift += 7;
+			}
+			result |= std::uint64_t(*in++) << shift;
+			return result;
+		}
+
+	}
+
+	/*
+	 * An immutable graph for inputs too large to fit in memory as a general_basic_graph.
+	 *
+	 * The sorted neighbor list of each vertex is stored as a byte stream of LEB128 varints:
+	 * the first neighbor as a zigzag-encoded difference from the source vertex, and each
+	 * subsequent one as a difference from its predecessor. If HasEdgeIds is true, every neighbor
+	 * is followed by the zigzag-encoded difference between its edge id and the previous edge id
+	 * in the list, and edges are numbered like in general_basic_graph.
+	 *
+	 * If HasEdgeIds is false, no edge ids are stored. Edges are identified by their endpoints,
+	 * as in general_dense_graph, and multiple edges are merged into one.
+	 *
+	 * Neighbor differences are small on graphs with locality, but edge ids follow the input
+	 * order, so their differences are close to random and take nearly as many bytes as plain
+	 * ids. With HasEdgeIds, expect the adjacency to take about half the memory of a
+	 * general_basic_graph; most of the savings need HasEdgeIds to be false.
+	 *
+	 * Creation: O(V + E), multithreaded with execution::par
+	 * Adjacency check: O(N(v))
+	 * Pass over outgoing_edges: O(N(v))
+	 * Pass over adjacent_vertices: O(N(v))
+	 * Pass over all_vertices: O(V)
+	 * Pass over all_edges: O(V + E)
+	 * Edge index lookup: O(N(u)) if HasEdgeIds, otherwise O(1)
+	 */
+
+	template<std::integral VIdxT, std::integral EIdxT = int, bool IsDirected = false, bool HasEdgeIds = true>
+	class general_compressed_graph {
+	public:
+		using edge_value_type = std::conditional_t<
+			HasEdgeIds,
+			edge_value<VIdxT, EIdxT, IsDirected>,
+			simplified_edge_value<VIdxT, IsDirected>
+		>;
+		using vertex_id_type = VIdxT;
+		using edge_id_type = typename edge_value_type::edge_id_type;
+
+		static constexpr bool is_directed = IsDirected;
+		static constexpr bool allows_loops = true;
+		static constexpr bool allows_multiple_edges = HasEdgeIds;
+
+		static constexpr bool has_natural_vertex_numbering = true;
+		static constexpr bool has_natural_edge_numbering = HasEdgeIds;
+		static constexpr bool outgoing_edges_uv_sorted = true;
+		static constexpr bool outgoing_edges_pre_swapped = true;
+
+		/*
+		 * Decodes the neighbor list of a single vertex.
+		 */
+		class outgoing_edge_iterator {
+		public:
+			using value_type = edge_value_type;
+			using difference_type = std::ptrdiff_t;
+			using iterator_concept = std::forward_iterator_tag;
+
+			outgoing_edge_iterator() = default;
+
+			outgoing_edge_iterator(const std::uint8_t* begin, const std::uint8_t* end, vertex_id_type u)
+				: next_(begin), end_(end), u_(u), at_end_(begin == end)
+			{
+				if(not at_end_) {
+					decode_next(true);
+				}
+			}
+
+			[[nodiscard]] edge_value_type operator*() const {
+				return current_;
+			}
+
+			outgoing_edge_iterator& operator++() {
+				if(next_ == end_) {
+					at_end_ = true;
+				} else {
+					decode_next(false);
+				}
+				return *this;
+			}
+
+			outgoing_edge_iterator operator++(int) {
+				auto result = *this;
+				++*this;
+				return result;
+			}
+
+			friend bool operator==(const outgoing_edge_iterator& a, const outgoing_edge_iterator& b) {
+				return a.next_ == b.next_ && a.at_end_ == b.at_end_;
+			}
+
+			friend bool operator==(const outgoing_edge_iterator& it, std::default_sentinel_t) {
+				return it.at_end_;
+			}
+
+		private:
+			const std::uint8_t* next_ = nullptr;
+			const std::uint8_t* end_ = nullptr;
+			vertex_id_type u_ {};
+			bool at_end_ = true;
+			edge_value_type current_ {};
+
+			void decode_next(bool is_first) {
+				auto gap = detail::read_varint(next_);
+				vertex_id_type v = is_first
+					? vertex_id_type(u_ + detail::zigzag_decode(gap))
+					: vertex_id_type(current_.v + gap);
+
+				if constexpr(HasEdgeIds) {
+					std::int64_t prev_id = is_first ? 0 : current_.i;
+					current_ = {u_, v, edge_id_type(prev_id + detail::zigzag_decode(detail::read_varint(next_)))};
+				} else {
+					current_ = {u_, v};
+				}
+			}
+		};
+
+	private:
+		using build_edge_type = edge_value<VIdxT, EIdxT, IsDirected>;
+
+		isize num_vertices_ = 0;
+		isize num_edges_ = 0;
+
+		std::vector<std::uint8_t> adjacency_bytes_;
+
+		//the i-th and i+1-th elements denote the byte range of the neighbor list of vertex i
+		std::vector<std::uint64_t> byte_offsets_;
+
+		//i-th element is the source vertex of the edge i, used for edge index lookups
+		std::vector<vertex_id_type> edge_sources_;
+
+		static int encoded_size(const build_edge_type& e, const build_edge_type* prev) {
+			int size = prev
+				? detail::varint_size(e.v - prev->v)
+				: detail::varint_size(detail::zigzag_encode(std::int64_t(e.v) - std::int64_t(e.u)));
+			if constexpr(HasEdgeIds) {
+				std::int64_t prev_id = prev ? prev->i : 0;
+				size += detail::varint_size(detail::zigzag_encode(std::int64_t(e.i) - prev_id));
+			}
+			return size;
+		}
+
+		static void encode(std::uint8_t*& out, const build_edge_type& e, const build_edge_type* prev) {
+			if(prev) {
+				detail::write_varint(out, e.v - prev->v);
+			} else {
+				detail::write_varint(out, detail::zigzag_encode(std::int64_t(e.v) - std::int64_t(e.u)));
+			}
+			if constexpr(HasEdgeIds) {
+				std::int64_t prev_id = prev ? prev->i : 0;
+				detail::write_varint(out, detail::zigzag_encode(std::int64_t(e.i) - prev_id));
+			}
+		}
+
+		/*
+		 * Calls fn(half_edge, previous_encoded_half_edge_or_null) for the half-edges of u that are
+		 * encoded, which is all of them unless multiple edges are merged.
+		 */
+		template<typename OffsetT>
+		static void for_each_encoded_half_edge(
+			const std::vector<build_edge_type>& half_edges,
+			const std::vector<OffsetT>& regions,
+			isize u,
+			auto&& fn)
+		{
+			const build_edge_type* prev = nullptr;
+			for(isize k=regions[u]; k<regions[u+1]; k++) {
+				const auto& e = half_edges[k];
+				if constexpr(not HasEdgeIds) {
+					if(prev && prev->v == e.v) {
+						continue;
+					}
+				}
+				fn(e, prev);
+				prev = &e;
+			}
+		}
+
+	public:
+
+		general_compressed_graph(vertex_count num_vertices, std::ranges::forward_range auto&& edges)
+			: general_compressed_graph(execution::seq, num_vertices, std::forward<decltype(edges)>(edges))
+		{
+
+		}
+
+		/*
+		 * Encoding is split between threads by vertex ranges when a parallel execution policy is given.
+		 * The uncompressed half-edges are sorted through a second array of the same size, and both
+		 * exist while sorting, so peak memory usage is about twice the half-edge list of a
+		 * general_basic_graph, and the sorted list is still alive while the output is encoded.
+		 */
+		general_compressed_graph(
+			const execution::execution_policy auto& policy,
+			vertex_count num_vertices,
+			std::ranges::forward_range auto&& edges)
+		{
+			auto list = detail::collect_csr_half_edges<build_edge_type>(policy, num_vertices, edges);
+			int num_chunks = detail::num_workers_for(policy, list.half_edges.size(), detail::csr_min_half_edges_per_thread);
+
+			std::vector<EIdxT> regions;
+			num_vertices_ = detail::sort_csr_half_edges(num_chunks, num_vertices, list, regions);
+			const auto& half_edges = list.half_edges;
+
+			// first pass: the encoded size of each neighbor list
+			byte_offsets_.assign(num_vertices_ + 1, 0);
+			std::vector<isize> chunk_num_edges(num_chunks, 0);
+			detail::parallel_for_chunks(num_chunks, num_vertices_, [&](int chunk, isize begin, isize end) {
+				for(isize u=begin; u<end; u++) {
+					std::uint64_t size = 0;
+					for_each_encoded_half_edge(half_edges, regions, u, [&](const build_edge_type& e, const build_edge_type* prev) {
+						size += encoded_size(e, prev);
+						if(detail::is_representative_half_edge(e)) {
+							++chunk_num_edges[chunk];
+						}
+					});
+					byte_offsets_[u+1] = size;
+				}
+			});
+			for(isize u=0; u<num_vertices_; u++) {
+				byte_offsets_[u+1] += byte_offsets_[u];
+			}
+
+			num_edges_ = HasEdgeIds ? isize(list.num_edges) : std::ranges::fold_left(chunk_num_edges, isize(0), std::plus{});
+			adjacency_bytes_.resize(byte_offsets_.back());
+			if constexpr(HasEdgeIds) {
+				edge_sources_.resize(num_edges_);
+			}
+
+			// second pass: encode
+			detail::parallel_for_chunks(num_chunks, num_vertices_, [&](int, isize begin, isize end) {
+				for(isize u=begin; u<end; u++) {
+					std::uint8_t* out = adjacency_bytes_.data() + byte_offsets_[u];
+					for_each_encoded_half_edge(half_edges, regions, u, [&](const build_edge_type& e, const build_edge_type* prev) {
+						encode(out, e, prev);
+						if constexpr(HasEdgeIds) {
+							if(detail::is_representative_half_edge(e)) {
+								edge_sources_[e.i] = e.u;
+							}
+						}
+					});
+				}
+			});
+		}
+
+		[[nodiscard]] isize num_vertices() const {
+			return num_vertices_;
+		}
+
+		[[nodiscard]] isize num_edges() const {
+			return num_edges_;
+		}
+
+		[[nodiscard]] auto outgoing_edges(vertex_id_type u) const {
+			const std::uint8_t* base = adjacency_bytes_.data();
+			return std::ranges::subrange(
+				outgoing_edge_iterator(base + byte_offsets_.at(u), base + byte_offsets_.at(u+1), u),
+				std::default_sentinel
+			);
+		}
+
+		[[nodiscard]] bool is_adjacent(vertex_id_type u, vertex_id_type v) const {
+			for(const auto& e: outgoing_edges(u)) {
+				if(e.v >= v) {
+					return e.v == v;
+				}
+			}
+			return false;
+		}
+
+		[[nodiscard]] auto edge_at(edge_id_type index) const requires HasEdgeIds {
+			for(const auto& e: outgoing_edges(edge_sources_[index])) {
+				if(e.i == index) {
+					return e;
+				}
+			}
+			throw std::out_of_range(std::format("edge index {} not found", index));
+		}
+
+		[[nodiscard]] auto all_vertices() const {
+			return std::views::iota(0, num_vertices());
+		}
+
+		[[nodiscard]] auto all_edges() const {
+			return all_vertices()
+				| std::views::transform([this](auto u) {return outgoing_edges(u);})
+				| std::views::join
+				| std::views::filter([](const edge_value_type& e) {return detail::is_representative_half_edge(e);});
+		}
+
+		/*
+		 * The number of bytes occupied by the adjacency structure.
+		 */
+		[[nodiscard]] isize memory_usage() const {
+			return adjacency_bytes_.size() * sizeof(std::uint8_t)
+				+ byte_offsets_.size() * sizeof(std::uint64_t)
+				+ edge_sources_.size() * sizeof(vertex_id_type);
+		}
+
+	};
+
+	template<typename VIdxT, typename EIdxT = int>
+	using general_compressed_digraph = general_compressed_graph<VIdxT, EIdxT, true>;
+
+	using compressed_graph = general_compressed_graph<int>;
+	using compressed_digraph = general_compressed_digraph<int>;
+
+	// variants without stored edge ids, in which multiple edges are merged
+	using compressed_simple_graph = general_compressed_graph<int, int, false, false>;
+	using compressed_simple_digraph = general_compressed_graph<int, int, true, false>;
+
+	static_assert(graph<compressed_graph>);
+	static_assert(graph<compressed_simple_graph>);
+
+}
+
+#endif //GRAPH2X_COMPRESSED_GRAPH_HPP
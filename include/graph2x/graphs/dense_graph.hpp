@@ -18,6 +18,7 @@ namespace g2x {
 		static constexpr bool has_natural_vertex_numbering = true;
 		static constexpr bool has_natural_edge_numbering = false;
 		static constexpr bool outgoing_edges_uv_sorted = true;
+		static constexpr bool outgoing_edges_pre_swapped = true;
 
 		using edge_value_type = simplified_edge_value<VIdxT, IsDirected>;
 		using vertex_id_type = typename edge_value_type::vertex_id_type;
@@ -25,8 +26,9 @@ namespace g2x {
 
 	private:
 
-		using adj_matrix_element_type = std::conditional_t<IsCompact, bool, boolean>;
-		array_2d<adj_matrix_element_type> adj_matrix_;
+		// the compact variant stores one bit per vertex pair, the other one byte per vertex pair
+		using adj_matrix_type = std::conditional_t<IsCompact, bit_matrix, array_2d<boolean>>;
+		adj_matrix_type adj_matrix_;
 
 		[[nodiscard]] bool is_coord_in_unique_region(vertex_id_type u, vertex_id_type v) const {
 			if constexpr(not IsDirected) {
@@ -35,14 +37,54 @@ namespace g2x {
 			return true;
 		}
 
-		[[nodiscard]] decltype(auto) adj_matrix_ref(this auto&& self, vertex_id_type u, vertex_id_type v) {
-			return self.adj_matrix_.at(u, v);
+		// row u of the matrix holds the outgoing edges of u, so that it is contiguous in memory
+		[[nodiscard]] bool get_adj(vertex_id_type u, vertex_id_type v) const {
+			if constexpr(IsCompact) {
+				return adj_matrix_.get(u, v);
+			} else {
+				return adj_matrix_.at(v, u);
+			}
+		}
+
+		void set_adj(vertex_id_type u, vertex_id_type v, bool value) {
+			if constexpr(IsCompact) {
+				adj_matrix_.set(u, v, value);
+			} else {
+				adj_matrix_.at(v, u) = value;
+			}
+		}
+
+		[[nodiscard]] auto adjacent_vertices_impl(vertex_id_type u) const {
+			if constexpr(IsCompact) {
+				return adj_matrix_.row_set_bits(u)
+					| std::views::transform([](isize v) {return vertex_id_type(v);});
+			} else {
+				const char* row = adj_matrix_.data() + adj_matrix_.coord_to_offset(0, u);
+				return detail::nonzero_byte_indices(row, num_vertices())
+					| std::views::transform([](isize v) {return vertex_id_type(v);});
+			}
+		}
+
+		[[nodiscard]] static adj_matrix_type make_adj_matrix(isize num_vertices) {
+			if constexpr(IsCompact) {
+				return bit_matrix(num_vertices, num_vertices);
+			} else {
+				return array_2d<boolean>(num_vertices, num_vertices, false);
+			}
+		}
+
+		[[nodiscard]] isize count_row(vertex_id_type u) const {
+			if constexpr(IsCompact) {
+				return adj_matrix_.row_popcount(u);
+			} else {
+				return std::ranges::distance(adjacent_vertices_impl(u));
+			}
 		}
 
 	public:
 
 		explicit general_dense_graph(vertex_count num_vertices)
-		: adj_matrix_(num_vertices.value(), num_vertices.value(), false) {
+		: adj_matrix_(make_adj_matrix(num_vertices.value())) {
 
 		}
 
@@ -58,56 +100,80 @@ namespace g2x {
 
 
 		[[nodiscard]] isize num_vertices() const {
-			return adj_matrix_.width();
+			if constexpr(IsCompact) {
+				return adj_matrix_.num_rows();
+			} else {
+				return adj_matrix_.width();
+			}
 		}
 
 		[[nodiscard]] auto all_vertices() const {
 			return std::views::iota(isize(0), isize(num_vertices()));
 		}
 
-		[[nodiscard]] auto outgoing_edges(vertex_id_type v) const {
-			//TODO replace with a non-allocating version
-			std::vector<edge_value_type> edges;
-
-			for(isize i=0; i<num_vertices(); ++i) {
-				if(is_adjacent(v, i)) {
-					edges.emplace_back(v, i);
-				}
-			}
+		[[nodiscard]] auto outgoing_edges(vertex_id_type u) const {
+			return adjacent_vertices_impl(u)
+				| std::views::transform([u](vertex_id_type v) {return edge_value_type{u, v};});
+		}
 
-			return edges;
+		[[nodiscard]] auto adjacent_vertices(vertex_id_type u) const {
+			return adjacent_vertices_impl(u);
 		}
 
 		[[nodiscard]] bool is_adjacent(vertex_id_type u, vertex_id_type v) const {
-			bool value = adj_matrix_ref(u, v);
-			return value;
+			return get_adj(u, v);
 		}
 
-		[[nodiscard]] auto all_edges() const {
-			//TODO replace with a non-allocating version
-			std::vector<edge_value_type> edges;
-			adj_matrix_.for_each_indexed([&](isize x, isize y, bool is_adjacent) {
-				if(is_adjacent && is_coord_in_unique_region(x, y)) {
-					edges.emplace_back(x, y);
+		[[nodiscard]] isize outdegree(vertex_id_type u) const {
+			return count_row(u);
+		}
+
+		// loops count twice towards the degree in undirected graphs
+		[[nodiscard]] isize degree(vertex_id_type u) const {
+			if constexpr(IsDirected) {
+				return count_row(u);
+			} else {
+				return count_row(u) + (get_adj(u, u) ? 1 : 0);
+			}
+		}
+
+		/*
+		 * Returns the number of vertices that are adjacent to both u and v.
+		 * For the compact variant, this is a popcount over the intersection of two rows.
+		 */
+		[[nodiscard]] isize num_common_neighbors(vertex_id_type u, vertex_id_type v) const {
+			if constexpr(IsCompact) {
+				return adj_matrix_.common_popcount(u, v);
+			} else {
+				isize result = 0;
+				for(auto w: adjacent_vertices_impl(u)) {
+					result += get_adj(v, w);
 				}
-			});
-			return edges;
+				return result;
+			}
+		}
+
+		[[nodiscard]] auto all_edges() const {
+			return all_vertices()
+				| std::views::transform([this](isize u) {return outgoing_edges(u);})
+				| std::views::join
+				| std::views::filter([this](const edge_value_type& e) {return is_coord_in_unique_region(e.u, e.v);});
 		}
 
 		edge_id_type create_edge(vertex_id_type u, vertex_id_type v) {
-			adj_matrix_ref(u, v) = true;
+			set_adj(u, v, true);
 			if constexpr (not IsDirected) {
-				adj_matrix_ref(v, u) = true;
+				set_adj(v, u, true);
 			}
 			return {u, v};
 		}
 
 		bool remove_edge(edge_id_type eid) {
 			const auto& [u, v] = eid;
-			bool r = adj_matrix_ref(u, v);
-			adj_matrix_ref(u, v) = false;
+			bool r = get_adj(u, v);
+			set_adj(u, v, false);
 			if constexpr (not IsDirected) {
-				adj_matrix_ref(v, u) = false;
+				set_adj(v, u, false);
 			}
 			return r;
 		}
@@ -118,7 +184,7 @@ namespace g2x {
 
 		template<typename T>
 		[[nodiscard]] auto create_edge_property() const {
-			return array_2d<T>(adj_matrix_.width(), adj_matrix_.height());
+			return array_2d<T>(num_vertices(), num_vertices());
 		}
 
 	};
@@ -0,0 +1,559 @@
+
+#ifndef GRAPH2X_GRAPH_VIEWS_HPP
+#define GRAPH2X_GRAPH_VIEWS_HPP
+
+#include <array>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "../core.hpp"
+#include "../util.hpp"
+
+
+namespace g2x {
+
+	/*
+	 * Graph views wrap a reference to another graph and present it as a different graph
+	 * without copying it. The wrapped graph (and any mask or predicate the view refers to)
+	 * must outlive the view and must not be modified while the view is in use.
+	 *
+	 * Views that keep the vertex and edge ids of the wrapped graph forward
+	 * create_vertex_property and create_edge_property to it, so properties of a view
+	 * can be indexed the same way as those of the wrapped graph.
+	 */
+
+	namespace detail {
+
+		template<typename GraphT>
+		concept lists_incoming_edges = not graph_traits::is_directed_v<GraphT>
+			|| requires(const GraphT& g, vertex_id_t<GraphT> v) {g.incoming_edges(v);};
+
+		/*
+		 * Lists the incoming edges of the vertices of a graph, like g2x::incoming_edges.
+		 * For digraphs that do not list incoming edges themselves, the edges are indexed
+		 * by target on construction, which takes O(V + E) time and memory.
+		 */
+		template<graph GraphT>
+			requires lists_incoming_edges<GraphT> || graph_traits::has_natural_vertex_numbering_v<GraphT>
+		class incoming_edge_lister {
+		public:
+			static constexpr bool is_lazy = lists_incoming_edges<GraphT>;
+
+			explicit incoming_edge_lister(const GraphT& graph)
+				: graph_(graph)
+			{
+				if constexpr(not is_lazy) {
+					isize n = g2x::num_vertices(graph_);
+					offsets_.assign(n + 1, 0);
+					for(const auto& e: g2x::all_edges(graph_)) {
+						++offsets_[e.v + 1];
+					}
+					for(isize v=0; v<n; v++) {
+						offsets_[v + 1] += offsets_[v];
+					}
+
+					std::vector<isize> cursors(offsets_.begin(), offsets_.end() - 1);
+					edges_.resize(offsets_.back());
+					for(const auto& e: g2x::all_edges(graph_)) {
+						edges_[cursors[e.v]++] = e;
+					}
+				}
+			}
+
+			[[nodiscard]] auto incoming_edges(vertex_id_t<GraphT> v) const {
+				if constexpr(is_lazy) {
+					return g2x::incoming_edges(graph_, v);
+				} else {
+					return std::span<const edge_t<GraphT>>(edges_).subspan(offsets_[v], offsets_[v + 1] - offsets_[v]);
+				}
+			}
+
+		private:
+			const GraphT& graph_;
+			std::vector<edge_t<GraphT>> edges_;
+			std::vector<isize> offsets_;
+		};
+
+		/*
+		 * Reads a vertex mask or a similar property through a const reference.
+		 */
+		[[nodiscard]] bool read_flag(const auto& property, const auto& key) {
+			if constexpr(requires{property[key];}) {
+				return bool(property[key]);
+			} else {
+				return bool(property.at(key));
+			}
+		}
+
+	}
+
+	/*
+	 * A digraph with all edges of another digraph reversed. Undirected graphs are their own
+	 * transpose. The outgoing edges of a vertex are the incoming edges of the wrapped graph,
+	 * so for digraphs that do not list incoming edges, the view indexes them once.
+	 *
+	 * Creation: O(1), or O(V + E) if incoming edges have to be indexed
+	 * Pass over outgoing_edges: like incoming_edges of the wrapped graph
+	 * Pass over incoming_edges: like outgoing_edges of the wrapped graph
+	 * Pass over all_vertices, all_edges: like the wrapped graph
+	 * Edge index lookup: like the wrapped graph
+	 */
+	template<graph GraphT>
+		requires detail::lists_incoming_edges<GraphT> || graph_traits::has_natural_vertex_numbering_v<GraphT>
+	class transposed_graph {
+	public:
+		using edge_value_type = edge_t<GraphT>;
+		using vertex_id_type = vertex_id_t<GraphT>;
+		using edge_id_type = edge_id_t<GraphT>;
+
+		static constexpr bool is_directed = graph_traits::is_directed_v<GraphT>;
+		static constexpr bool allows_loops = graph_traits::allows_loops_v<GraphT>;
+		static constexpr bool allows_multiple_edges = graph_traits::allows_multiple_edges_v<GraphT>;
+
+		static constexpr bool has_natural_vertex_numbering = graph_traits::has_natural_vertex_numbering_v<GraphT>;
+		static constexpr bool has_natural_edge_numbering = graph_traits::has_natural_edge_numbering_v<GraphT>;
+		static constexpr bool outgoing_edges_pre_swapped = true;
+		static constexpr bool incoming_edges_pre_swapped = true;
+
+		explicit transposed_graph(const GraphT& graph)
+			: graph_(graph), incoming_(graph)
+		{}
+
+		[[nodiscard]] const GraphT& base_graph() const {
+			return graph_;
+		}
+
+		[[nodiscard]] auto num_vertices() const {
+			return g2x::num_vertices(graph_);
+		}
+
+		[[nodiscard]] auto num_edges() const {
+			return g2x::num_edges(graph_);
+		}
+
+		[[nodiscard]] auto all_vertices() const {
+			return g2x::all_vertices(graph_);
+		}
+
+		[[nodiscard]] auto all_edges() const {
+			return transposed(g2x::all_edges(graph_));
+		}
+
+		[[nodiscard]] auto edge_at(edge_id_type index) const
+			requires (not simplified_edge_value_c<edge_value_type>)
+		{
+			const auto& [u, v, i] = g2x::edge_at(graph_, index);
+			return edge_value_type{v, u, i};
+		}
+
+		[[nodiscard]] auto outgoing_edges(vertex_id_type v) const {
+			return transposed(incoming_.incoming_edges(v));
+		}
+
+		[[nodiscard]] auto incoming_edges(vertex_id_type v) const
+			requires is_directed
+		{
+			return transposed(g2x::outgoing_edges(graph_, v));
+		}
+
+		template<typename T>
+		[[nodiscard]] auto create_vertex_property() const {
+			return g2x::create_vertex_property<T>(graph_);
+		}
+
+		template<typename T>
+		[[nodiscard]] auto create_edge_property() const {
+			return g2x::create_edge_property<T>(graph_);
+		}
+
+	private:
+		const GraphT& graph_;
+		detail::incoming_edge_lister<GraphT> incoming_;
+	};
+
+	/*
+	 * The subgraph induced by the vertices v for which mask[v] is true. Vertices and edges
+	 * keep their ids, so the view does not have natural vertex or edge numbering even if
+	 * the wrapped graph does.
+	 *
+	 * Creation: O(V + E), to count the vertices and edges
+	 * Pass over outgoing_edges: like the wrapped graph
+	 * Pass over all_vertices: O(V) of the wrapped graph
+	 * Pass over all_edges: like the wrapped graph
+	 */
+	template<graph GraphT, vertex_property_of<GraphT, bool> MaskT>
+	class induced_subgraph {
+	public:
+		using edge_value_type = edge_t<GraphT>;
+		using vertex_id_type = vertex_id_t<GraphT>;
+		using edge_id_type = edge_id_t<GraphT>;
+
+		static constexpr bool is_directed = graph_traits::is_directed_v<GraphT>;
+		static constexpr bool allows_loops = graph_traits::allows_loops_v<GraphT>;
+		static constexpr bool allows_multiple_edges = graph_traits::allows_multiple_edges_v<GraphT>;
+
+		static constexpr bool has_natural_vertex_numbering = false;
+		static constexpr bool has_natural_edge_numbering = false;
+		static constexpr bool outgoing_edges_uv_sorted = graph_traits::outgoing_edges_uv_sorted_v<GraphT>;
+		static constexpr bool outgoing_edges_pre_swapped = true;
+		static constexpr bool incoming_edges_pre_swapped = true;
+
+		induced_subgraph(const GraphT& graph, const MaskT& mask)
+			: graph_(graph), mask_(mask)
+		{
+			num_vertices_ = std::ranges::distance(all_vertices());
+			num_edges_ = std::ranges::distance(all_edges());
+		}
+
+		[[nodiscard]] const GraphT& base_graph() const {
+			return graph_;
+		}
+
+		[[nodiscard]] bool contains_vertex(vertex_id_type v) const {
+			return detail::read_flag(mask_, v);
+		}
+
+		[[nodiscard]] isize num_vertices() const {
+			return num_vertices_;
+		}
+
+		[[nodiscard]] isize num_edges() const {
+			return num_edges_;
+		}
+
+		[[nodiscard]] auto all_vertices() const {
+			return g2x::all_vertices(graph_) | std::views::filter([this](const vertex_id_type& v) {
+				return contains_vertex(v);
+			});
+		}
+
+		[[nodiscard]] auto all_edges() const {
+			return g2x::all_edges(graph_) | std::views::filter([this](const edge_value_type& e) {
+				return contains_vertex(e.u) && contains_vertex(e.v);
+			});
+		}
+
+		[[nodiscard]] auto edge_at(edge_id_type index) const {
+			return g2x::edge_at(graph_, index);
+		}
+
+		[[nodiscard]] bool is_adjacent(vertex_id_type u, vertex_id_type v) const {
+			return contains_vertex(u) && contains_vertex(v) && g2x::is_adjacent(graph_, u, v);
+		}
+
+		[[nodiscard]] auto outgoing_edges(vertex_id_type u) const {
+			return g2x::outgoing_edges(graph_, u) | std::views::filter([this](const edge_value_type& e) {
+				return contains_vertex(e.v);
+			});
+		}
+
+		[[nodiscard]] auto incoming_edges(vertex_id_type v) const
+			requires is_directed && requires(const GraphT& g, vertex_id_type w) {g.incoming_edges(w);}
+		{
+			return g2x::incoming_edges(graph_, v) | std::views::filter([this](const edge_value_type& e) {
+				return contains_vertex(e.u);
+			});
+		}
+
+		template<typename T>
+		[[nodiscard]] auto create_vertex_property() const {
+			return g2x::create_vertex_property<T>(graph_);
+		}
+
+		template<typename T>
+		[[nodiscard]] auto create_edge_property() const {
+			return g2x::create_edge_property<T>(graph_);
+		}
+
+	private:
+		const GraphT& graph_;
+		const MaskT& mask_;
+		isize num_vertices_ = 0;
+		isize num_edges_ = 0;
+	};
+
+	/*
+	 * The graph with only those edges of another graph for which predicate(edge) is true.
+	 * The predicate is called with edges in the orientation in which they are listed, so
+	 * for undirected graphs it should not depend on the order of the endpoints.
+	 *
+	 * Creation: O(E), to count the edges
+	 * Pass over outgoing_edges, all_edges: like the wrapped graph
+	 * Pass over all_vertices: like the wrapped graph
+	 */
+	template<graph GraphT, typename PredicateT>
+		requires std::predicate<const PredicateT&, const edge_t<GraphT>&>
+	class edge_filtered_graph {
+	public:
+		using edge_value_type = edge_t<GraphT>;
+		using vertex_id_type = vertex_id_t<GraphT>;
+		using edge_id_type = edge_id_t<GraphT>;
+
+		static constexpr bool is_directed = graph_traits::is_directed_v<GraphT>;
+		static constexpr bool allows_loops = graph_traits::allows_loops_v<GraphT>;
+		static constexpr bool allows_multiple_edges = graph_traits::allows_multiple_edges_v<GraphT>;
+
+		static constexpr bool has_natural_vertex_numbering = graph_traits::has_natural_vertex_numbering_v<GraphT>;
+		static constexpr bool has_natural_edge_numbering = false;
+		static constexpr bool outgoing_edges_uv_sorted = graph_traits::outgoing_edges_uv_sorted_v<GraphT>;
+		static constexpr bool outgoing_edges_pre_swapped = true;
+		static constexpr bool incoming_edges_pre_swapped = true;
+
+		edge_filtered_graph(const GraphT& graph, PredicateT predicate)
+			: graph_(graph), predicate_(std::move(predicate))
+		{
+			num_edges_ = std::ranges::distance(all_edges());
+		}
+
+		[[nodiscard]] const GraphT& base_graph() const {
+			return graph_;
+		}
+
+		[[nodiscard]] auto num_vertices() const {
+			return g2x::num_vertices(graph_);
+		}
+
+		[[nodiscard]] isize num_edges() const {
+			return num_edges_;
+		}
+
+		[[nodiscard]] auto all_vertices() const {
+			return g2x::all_vertices(graph_);
+		}
+
+		[[nodiscard]] auto all_edges() const {
+			return g2x::all_edges(graph_) | std::views::filter(std::cref(predicate_));
+		}
+
+		[[nodiscard]] auto edge_at(edge_id_type index) const {
+			return g2x::edge_at(graph_, index);
+		}
+
+		[[nodiscard]] auto outgoing_edges(vertex_id_type u) const {
+			return g2x::outgoing_edges(graph_, u) | std::views::filter(std::cref(predicate_));
+		}
+
+		[[nodiscard]] auto incoming_edges(vertex_id_type v) const
+			requires is_directed && requires(const GraphT& g, vertex_id_type w) {g.incoming_edges(w);}
+		{
+			return g2x::incoming_edges(graph_, v) | std::views::filter(std::cref(predicate_));
+		}
+
+		template<typename T>
+		[[nodiscard]] auto create_vertex_property() const {
+			return g2x::create_vertex_property<T>(graph_);
+		}
+
+		template<typename T>
+		[[nodiscard]] auto create_edge_property() const {
+			return g2x::create_edge_property<T>(graph_);
+		}
+
+	private:
+		const GraphT& graph_;
+		PredicateT predicate_;
+		isize num_edges_ = 0;
+	};
+
+	/*
+	 * The bipartite double cover (split graph) of a graph: every vertex v is split into
+	 * an "out" copy 2v and an "in" copy 2v+1, and every edge (u, v) becomes an edge between
+	 * 2u and 2v+1. An undirected edge {u, v} becomes two edges, one for each direction.
+	 * Matchings in this graph correspond to sets of directed edges in which no two
+	 * edges share a source or a target.
+	 *
+	 * For digraphs, edges keep their ids. For undirected graphs, the edge (u, v) of the
+	 * wrapped graph with id i corresponds to the edge with id 2i + (u > v).
+	 *
+	 * Adjacency is computed on the fly. The neighbors of an "in" copy are the sources of
+	 * the incoming edges of the vertex, so for digraphs that do not list incoming edges,
+	 * the view indexes them once. Vertex ids of the wrapped graph must fit in
+	 * vertex_id_t<GraphT> when doubled.
+	 *
+	 * Creation: O(1) for digraphs that list incoming edges, O(V + E) otherwise
+	 * Pass over outgoing_edges: like outgoing_edges or incoming_edges of the wrapped graph
+	 * Pass over all_vertices: O(V)
+	 * Pass over all_edges: like the wrapped graph
+	 * Edge index lookup: like the wrapped graph
+	 */
+	template<graph GraphT>
+		requires (detail::lists_incoming_edges<GraphT> || graph_traits::has_natural_vertex_numbering_v<GraphT>)
+			&& (graph_traits::is_directed_v<GraphT> || simplified_edge_value_c<edge_t<GraphT>> || std::integral<edge_id_t<GraphT>>)
+	class bipartite_double_cover {
+	public:
+		using base_edge_type = edge_t<GraphT>;
+		using vertex_id_type = vertex_id_t<GraphT>;
+		using edge_value_type = std::conditional_t<
+			simplified_edge_value_c<base_edge_type>,
+			simplified_edge_value<vertex_id_type, false>,
+			edge_value<vertex_id_type, edge_id_t<GraphT>, false>
+		>;
+		using edge_id_type = typename edge_value_type::edge_id_type;
+
+		static constexpr bool is_directed = false;
+		static constexpr bool allows_loops = false;
+		static constexpr bool allows_multiple_edges = graph_traits::allows_multiple_edges_v<GraphT>;
+
+		static constexpr bool has_natural_vertex_numbering = graph_traits::has_natural_vertex_numbering_v<GraphT>;
+		static constexpr bool has_natural_edge_numbering =
+			graph_traits::has_natural_edge_numbering_v<GraphT> && graph_traits::is_directed_v<GraphT>;
+		static constexpr bool outgoing_edges_uv_sorted = false;
+		static constexpr bool outgoing_edges_pre_swapped = true;
+
+		explicit bipartite_double_cover(const GraphT& graph)
+			: graph_(graph), incoming_(graph)
+		{
+			num_edges_ = g2x::num_edges(graph_);
+			if constexpr(not base_is_directed) {
+				// loops are the only edges that do not become two
+				num_edges_ *= 2;
+				for(const auto& [u, v, i]: g2x::all_edges(graph_)) {
+					num_edges_ -= (u == v);
+				}
+			}
+		}
+
+		[[nodiscard]] static vertex_id_type out_vertex(vertex_id_type v) {
+			return vertex_id_type(2 * v);
+		}
+
+		[[nodiscard]] static vertex_id_type in_vertex(vertex_id_type v) {
+			return vertex_id_type(2 * v + 1);
+		}
+
+		[[nodiscard]] static vertex_id_type base_vertex(vertex_id_type x) {
+			return vertex_id_type(x >> 1);
+		}
+
+		[[nodiscard]] static bool is_in_vertex(vertex_id_type x) {
+			return x & 1;
+		}
+
+		/*
+		 * Returns the edge of the wrapped graph that corresponds to an edge of the view,
+		 * oriented from the vertex of the "out" copy to the vertex of the "in" copy.
+		 */
+		[[nodiscard]] static base_edge_type base_edge(const edge_value_type& e) {
+			auto [out, in] = is_in_vertex(e.u) ? std::pair{e.v, e.u} : std::pair{e.u, e.v};
+			if constexpr(simplified_edge_value_c<base_edge_type>) {
+				return base_edge_type{base_vertex(out), base_vertex(in)};
+			} else if constexpr(base_is_directed) {
+				return base_edge_type{base_vertex(out), base_vertex(in), e.i};
+			} else {
+				return base_edge_type{base_vertex(out), base_vertex(in), edge_id_t<GraphT>(e.i / 2)};
+			}
+		}
+
+		[[nodiscard]] const GraphT& base_graph() const {
+			return graph_;
+		}
+
+		[[nodiscard]] isize num_vertices() const {
+			return 2 * isize(g2x::num_vertices(graph_));
+		}
+
+		[[nodiscard]] isize num_edges() const {
+			return num_edges_;
+		}
+
+		[[nodiscard]] auto all_vertices() const {
+			if constexpr(has_natural_vertex_numbering) {
+				return std::views::iota(0, num_vertices());
+			} else {
+				return g2x::all_vertices(graph_)
+					| std::views::transform([](vertex_id_type v) {return std::array{out_vertex(v), in_vertex(v)};})
+					| std::views::join;
+			}
+		}
+
+		[[nodiscard]] auto all_edges() const {
+			if constexpr(base_is_directed) {
+				return g2x::all_edges(graph_) | std::views::transform([](const base_edge_type& e) {
+					return from_out_vertex(e);
+				});
+			} else {
+				// every direction of an edge is listed at the "out" copy of its source
+				return g2x::all_vertices(graph_)
+					| std::views::transform([this](vertex_id_type v) {return out_adjacency(v);})
+					| std::views::join;
+			}
+		}
+
+		[[nodiscard]] auto edge_at(edge_id_type index) const
+			requires (not simplified_edge_value_c<base_edge_type>)
+		{
+			if constexpr(base_is_directed) {
+				return from_out_vertex(g2x::edge_at(graph_, index));
+			} else {
+				auto e = g2x::edge_at(graph_, edge_id_t<GraphT>(index / 2));
+				bool from_larger = index % 2;
+				return from_out_vertex(e.swap_to_first(from_larger ? std::max(e.u, e.v) : std::min(e.u, e.v)));
+			}
+		}
+
+		[[nodiscard]] auto outgoing_edges(vertex_id_type x) const {
+			auto v = base_vertex(x);
+			using result_type = detail::either_view<decltype(out_adjacency(v)), decltype(in_adjacency(v))>;
+			if(is_in_vertex(x)) {
+				return result_type(std::in_place_index<1>, in_adjacency(v));
+			} else {
+				return result_type(std::in_place_index<0>, out_adjacency(v));
+			}
+		}
+
+		template<typename T>
+		[[nodiscard]] auto create_edge_property() const
+			requires simplified_edge_value_c<base_edge_type>
+				|| (graph_traits::has_natural_edge_numbering_v<GraphT> && not base_is_directed)
+		{
+			if constexpr(simplified_edge_value_c<base_edge_type>) {
+				return array_2d<T>(num_vertices(), num_vertices());
+			} else {
+				// ids are not contiguous if there are loops
+				return std::vector<T>(2 * g2x::num_edges(graph_));
+			}
+		}
+
+	private:
+		static constexpr bool base_is_directed = graph_traits::is_directed_v<GraphT>;
+
+		// the edge (u, v) of the wrapped graph, from the "out" copy of u to the "in" copy of v
+		static edge_value_type make_edge(vertex_id_type x, vertex_id_type y, const base_edge_type& e) {
+			if constexpr(simplified_edge_value_c<base_edge_type>) {
+				return edge_value_type{x, y};
+			} else if constexpr(base_is_directed) {
+				return edge_value_type{x, y, e.i};
+			} else {
+				return edge_value_type{x, y, edge_id_type(2 * e.i + (e.u > e.v))};
+			}
+		}
+
+		static edge_value_type from_out_vertex(const base_edge_type& e) {
+			return make_edge(out_vertex(e.u), in_vertex(e.v), e);
+		}
+
+		static edge_value_type from_in_vertex(const base_edge_type& e) {
+			return make_edge(in_vertex(e.v), out_vertex(e.u), e);
+		}
+
+		auto out_adjacency(vertex_id_type v) const {
+			return g2x::outgoing_edges(graph_, v) | std::views::transform([](const base_edge_type& e) {
+				return from_out_vertex(e);
+			});
+		}
+
+		auto in_adjacency(vertex_id_type v) const {
+			return incoming_.incoming_edges(v) | std::views::transform([](const base_edge_type& e) {
+				return from_in_vertex(e);
+			});
+		}
+
+		const GraphT& graph_;
+		detail::incoming_edge_lister<GraphT> incoming_;
+		isize num_edges_ = 0;
+	};
+
+}
+
+#endif //GRAPH2X_GRAPH_VIEWS_HPP
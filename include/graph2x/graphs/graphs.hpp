@@ -4,8 +4,12 @@
 
 #include "dynamic_graph.hpp"
 #include "basic_graph.hpp"
+#include "soa_basic_graph.hpp"
+#include "compressed_graph.hpp"
+#include "mapped_basic_graph.hpp"
 #include "dense_graph.hpp"
 #include "nested_vec_graph.hpp"
 #include "dynamic_list_graph.hpp"
+#include "graph_views.hpp"
 
 #endif //GRAPH2X_GRAPHS_HPP_BD3FAF99B75B420888563CFB66CC2621
@@ -0,0 +1,427 @@
+
+#ifndef GRAPH2X_MAPPED_BASIC_GRAPH_HPP
+#define GRAPH2X_MAPPED_BASIC_GRAPH_HPP
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "../core.hpp"
+#include "basic_graph.hpp"
+
+
+namespace g2x {
+
+	namespace detail {
+
+		/*
+		 * A read-only memory mapping of an entire file.
+		 */
+		class mapped_file {
+		public:
+			mapped_file() = default;
+
+			explicit mapped_file(const std::filesystem::path& path) {
+#ifdef _WIN32
+				file_handle_ = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+				if(file_handle_ == INVALID_HANDLE_VALUE) {
+					throw_last_error(path, "cannot open");
+				}
+				LARGE_INTEGER file_size;
+				if(not GetFileSizeEx(file_handle_, &file_size)) {
+					close();
+					throw_last_error(path, "cannot get the size of");
+				}
+				size_ = file_size.QuadPart;
+				if(size_ > 0) {
+					mapping_handle_ = CreateFileMappingW(file_handle_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+					if(mapping_handle_ == nullptr) {
+						close();
+						throw_last_error(path, "cannot map");
+					}
+					data_ = static_cast<const std::byte*>(MapViewOfFile(mapping_handle_, FILE_MAP_READ, 0, 0, 0));
+					if(data_ == nullptr) {
+						close();
+						throw_last_error(path, "cannot map");
+					}
+				}
+#else
+				int fd = ::open(path.c_str(), O_RDONLY);
+				if(fd < 0) {
+					throw_last_error(path, "cannot open");
+				}
+				struct stat st {};
+				if(::fstat(fd, &st) != 0) {
+					::close(fd);
+					throw_last_error(path, "cannot stat");
+				}
+				size_ = st.st_size;
+				if(size_ > 0) {
+					void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+					if(addr == MAP_FAILED) {
+						::close(fd);
+						throw_last_error(path, "cannot map");
+					}
+					data_ = static_cast<const std::byte*>(addr);
+				}
+				// the mapping stays valid after the descriptor is closed
+				::close(fd);
+#endif
+			}
+
+			mapped_file(const mapped_file&) = delete;
+			mapped_file& operator=(const mapped_file&) = delete;
+
+			mapped_file(mapped_file&& other) noexcept {
+				swap(other);
+			}
+
+			mapped_file& operator=(mapped_file&& other) noexcept {
+				mapped_file tmp {std::move(other)};
+				swap(tmp);
+				return *this;
+			}
+
+			~mapped_file() {
+				close();
+			}
+
+			void swap(mapped_file& other) noexcept {
+				std::swap(data_, other.data_);
+				std::swap(size_, other.size_);
+#ifdef _WIN32
+				std::swap(file_handle_, other.file_handle_);
+				std::swap(mapping_handle_, other.mapping_handle_);
+#endif
+			}
+
+			[[nodiscard]] const std::byte* data() const {
+				return data_;
+			}
+
+			[[nodiscard]] std::size_t size() const {
+				return size_;
+			}
+
+		private:
+			const std::byte* data_ = nullptr;
+			std::size_t size_ = 0;
+
+#ifdef _WIN32
+			HANDLE file_handle_ = INVALID_HANDLE_VALUE;
+			HANDLE mapping_handle_ = nullptr;
+#endif
+
+			[[noreturn]] static void throw_last_error(const std::filesystem::path& path, const char* what) {
+#ifdef _WIN32
+				int error_code = int(GetLastError());
+#else
+				int error_code = errno;
+#endif
+				throw std::system_error(error_code, std::system_category(), std::format("{} {}", what, path.string()));
+			}
+
+			void close() {
+#ifdef _WIN32
+				if(data_) {
+					UnmapViewOfFile(data_);
+				}
+				if(mapping_handle_) {
+					CloseHandle(mapping_handle_);
+				}
+				if(file_handle_ != INVALID_HANDLE_VALUE) {
+					CloseHandle(file_handle_);
+				}
+				mapping_handle_ = nullptr;
+				file_handle_ = INVALID_HANDLE_VALUE;
+#else
+				if(data_) {
+					::munmap(const_cast<std::byte*>(data_), size_);
+				}
+#endif
+				data_ = nullptr;
+				size_ = 0;
+			}
+		};
+
+
+		/*
+		 * Header of the binary CSR graph format. All arrays follow the header at
+		 * the given byte offsets, each aligned to mapped_graph_alignment bytes.
+		 *
+		 * The arrays are stored in the native byte order and layout of the writing machine.
+		 * The header records enough information to reject files written with a different one.
+		 */
+		struct mapped_graph_header {
+			static constexpr std::array<char, 8> expected_magic {'G', '2', 'X', 'C', 'S', 'R', '\0', '\0'};
+			static constexpr std::uint32_t current_version = 1;
+			static constexpr std::uint32_t native_endianness_mark = 0x01020304;
+
+			std::array<char, 8> magic = expected_magic;
+			std::uint32_t version = current_version;
+			std::uint32_t endianness_mark = native_endianness_mark;
+
+			std::uint8_t vertex_id_size = 0;
+			std::uint8_t edge_id_size = 0;
+			std::uint8_t edge_value_size = 0;
+			std::uint8_t is_directed = 0;
+			std::uint32_t reserved = 0;
+
+			std::uint64_t num_vertices = 0;
+			std::uint64_t num_edges = 0;
+			std::uint64_t num_half_edges = 0;
+
+			std::uint64_t adjacency_regions_offset = 0;
+			std::uint64_t edge_storage_offset = 0;
+			std::uint64_t offset_of_edge_offset = 0;
+		};
+
+		inline constexpr std::uint64_t mapped_graph_alignment = 64;
+
+		[[nodiscard]] inline std::uint64_t align_mapped_offset(std::uint64_t offset) {
+			return (offset + mapped_graph_alignment - 1) / mapped_graph_alignment * mapped_graph_alignment;
+		}
+
+	}
+
+	/*
+	 * Writes a general_basic_graph to a file that can be opened with general_mapped_basic_graph.
+	 */
+	template<typename VIdxT, typename EIdxT, bool IsDirected>
+	void write_mapped_graph(const general_basic_graph<VIdxT, EIdxT, IsDirected>& graph, const std::filesystem::path& path) {
+		using edge_value_type = typename general_basic_graph<VIdxT, EIdxT, IsDirected>::edge_value_type;
+
+		auto adjacency_regions = graph.raw_adjacency_regions();
+		auto edge_storage = graph.raw_edge_storage();
+		auto offset_of_edge = graph.raw_offset_of_edge();
+
+		detail::mapped_graph_header header;
+		header.vertex_id_size = sizeof(VIdxT);
+		header.edge_id_size = sizeof(EIdxT);
+		header.edge_value_size = sizeof(edge_value_type);
+		header.is_directed = IsDirected;
+		header.num_vertices = graph.num_vertices();
+		header.num_edges = graph.num_edges();
+		header.num_half_edges = edge_storage.size();
+
+		header.adjacency_regions_offset = detail::align_mapped_offset(sizeof(header));
+		header.edge_storage_offset = detail::align_mapped_offset(header.adjacency_regions_offset + adjacency_regions.size_bytes());
+		header.offset_of_edge_offset = detail::align_mapped_offset(header.edge_storage_offset + edge_storage.size_bytes());
+
+		std::ofstream out(path, std::ios::binary | std::ios::trunc);
+		if(not out) {
+			throw std::runtime_error(std::format("cannot open {} for writing", path.string()));
+		}
+
+		auto write_at = [&](std::uint64_t offset, const void* data, std::size_t size) {
+			static constexpr char padding[detail::mapped_graph_alignment] {};
+			out.write(padding, std::streamsize(offset - std::uint64_t(out.tellp())));
+			out.write(static_cast<const char*>(data), std::streamsize(size));
+		};
+		write_at(0, &header, sizeof(header));
+		write_at(header.adjacency_regions_offset, adjacency_regions.data(), adjacency_regions.size_bytes());
+		write_at(header.edge_storage_offset, edge_storage.data(), edge_storage.size_bytes());
+		write_at(header.offset_of_edge_offset, offset_of_edge.data(), offset_of_edge.size_bytes());
+
+		if(not out) {
+			throw std::runtime_error(std::format("error while writing {}", path.string()));
+		}
+	}
+
+
+	/*
+	 * An immutable graph served directly from a file written by write_mapped_graph.
+	 * The file is memory-mapped, so its pages are shared with other processes that map
+	 * the same file.
+	 *
+	 * The template parameters must match those of the general_basic_graph that was written.
+	 * Opening only checks the header and that the arrays fit in the file, so the contents of
+	 * the file are trusted. Files from untrusted sources should be checked with validate()
+	 * before use, since corrupt arrays cause out-of-bounds reads.
+	 *
+	 * Opening: O(1)
+	 * Validation: O(V + E)
+	 * Adjacency check: O(log(N(v)))
+	 * Pass over outgoing_edges: O(N(v))
+	 * Pass over adjacent_vertices: O(N(v))
+	 * Pass over all_vertices: O(V)
+	 * Pass over all_edges: O(E)
+	 * Edge index lookup: O(1)
+	 */
+	template<std::integral VIdxT, std::integral EIdxT = int, bool IsDirected = false>
+	class general_mapped_basic_graph {
+	public:
+		using vertex_id_type = VIdxT;
+		using edge_id_type = EIdxT;
+		using edge_offset_type = edge_id_type;
+		using edge_value_type = edge_value<vertex_id_type, edge_id_type, IsDirected>;
+
+		static constexpr bool is_directed = IsDirected;
+		static constexpr bool allows_loops = true;
+		static constexpr bool allows_multiple_edges = true;
+
+		static constexpr bool has_natural_vertex_numbering = true;
+		static constexpr bool has_natural_edge_numbering = true;
+		static constexpr bool outgoing_edges_uv_sorted = true;
+		static constexpr bool outgoing_edges_pre_swapped = true;
+
+	private:
+		detail::mapped_file file_;
+
+		isize num_vertices_ = 0;
+		std::span<const edge_value_type> edge_storage;
+		std::span<const edge_offset_type> adjacency_regions;
+		std::span<const edge_offset_type> offset_of_edge;
+		std::filesystem::path path_;
+
+		[[nodiscard]] std::pair<edge_offset_type, edge_offset_type> get_adjacency_range(vertex_id_type v) const {
+			return {adjacency_regions[v], adjacency_regions[v+1]};
+		}
+
+		template<typename T>
+		[[nodiscard]] std::span<const T> array_at(std::uint64_t offset, std::uint64_t count, const std::filesystem::path& path) const {
+			if(offset % alignof(T) != 0 || offset > file_.size() || count > (file_.size() - offset) / sizeof(T)) {
+				throw std::runtime_error(std::format("{}: array out of file bounds", path.string()));
+			}
+			return {reinterpret_cast<const T*>(file_.data() + offset), std::size_t(count)};
+		}
+
+	public:
+
+		explicit general_mapped_basic_graph(const std::filesystem::path& path)
+			: file_(path)
+		{
+			detail::mapped_graph_header header;
+			if(file_.size() < sizeof(header)) {
+				throw std::runtime_error(std::format("{}: file too small to be a graph", path.string()));
+			}
+			std::memcpy(&header, file_.data(), sizeof(header));
+
+			if(header.magic != detail::mapped_graph_header::expected_magic) {
+				throw std::runtime_error(std::format("{}: not a graph file", path.string()));
+			}
+			if(header.version != detail::mapped_graph_header::current_version) {
+				throw std::runtime_error(std::format("{}: unsupported format version {}", path.string(), header.version));
+			}
+			if(header.endianness_mark != detail::mapped_graph_header::native_endianness_mark) {
+				throw std::runtime_error(std::format("{}: written on a machine with a different byte order", path.string()));
+			}
+			if(header.vertex_id_size != sizeof(VIdxT) || header.edge_id_size != sizeof(EIdxT)
+				|| header.edge_value_size != sizeof(edge_value_type) || bool(header.is_directed) != IsDirected) {
+				throw std::runtime_error(std::format("{}: graph type mismatch", path.string()));
+			}
+
+			if(header.num_vertices > std::uint64_t(std::numeric_limits<vertex_id_type>::max())
+				|| header.num_edges > std::uint64_t(std::numeric_limits<edge_id_type>::max())
+				|| header.num_half_edges > std::uint64_t(std::numeric_limits<edge_offset_type>::max())) {
+				throw std::runtime_error(std::format("{}: graph too large for its vertex or edge id type", path.string()));
+			}
+
+			num_vertices_ = header.num_vertices;
+			adjacency_regions = array_at<edge_offset_type>(header.adjacency_regions_offset, header.num_vertices + 1, path);
+			edge_storage = array_at<edge_value_type>(header.edge_storage_offset, header.num_half_edges, path);
+			offset_of_edge = array_at<edge_offset_type>(header.offset_of_edge_offset, header.num_edges, path);
+			if(adjacency_regions.front() != 0 || std::cmp_not_equal(adjacency_regions.back(), header.num_half_edges)) {
+				throw std::runtime_error(std::format("{}: corrupt graph file (adjacency regions do not span the edge storage)", path.string()));
+			}
+			path_ = path;
+		}
+
+		/*
+		 * Checks the contents of the arrays in a single pass over them: the adjacency regions
+		 * are ordered, every half-edge lies in the region of its source, has a valid target
+		 * and edge id, and every edge offset points at a half-edge of that edge.
+		 * Throws std::runtime_error on the first inconsistency.
+		 */
+		void validate() const {
+			auto fail = [&](std::string_view what) {
+				throw std::runtime_error(std::format("{}: corrupt graph file ({})", path_.string(), what));
+			};
+			if(not std::ranges::is_sorted(adjacency_regions)) {
+				fail("adjacency regions are not ordered");
+			}
+			isize num_edges = offset_of_edge.size();
+			for(isize u=0; u<num_vertices_; u++) {
+				for(isize k=adjacency_regions[u]; k<isize(adjacency_regions[u+1]); k++) {
+					const auto& e = edge_storage[k];
+					if(std::cmp_not_equal(e.u, u)) {
+						fail("half-edge outside the region of its source");
+					}
+					if(std::cmp_less(e.v, 0) || std::cmp_greater_equal(e.v, num_vertices_)) {
+						fail("vertex id out of range");
+					}
+					if(std::cmp_less(e.i, 0) || std::cmp_greater_equal(e.i, num_edges)) {
+						fail("edge id out of range");
+					}
+				}
+			}
+			for(isize i=0; i<num_edges; i++) {
+				auto offset = offset_of_edge[i];
+				if(std::cmp_less(offset, 0) || std::cmp_greater_equal(offset, edge_storage.size()) || std::cmp_not_equal(edge_storage[offset].i, i)) {
+					fail("edge offset out of range");
+				}
+			}
+		}
+
+		[[nodiscard]] isize num_vertices() const {
+			return num_vertices_;
+		}
+
+		[[nodiscard]] isize num_edges() const {
+			return offset_of_edge.size();
+		}
+
+		[[nodiscard]] auto outgoing_edges(vertex_id_type u) const {
+			auto [beg, end] = get_adjacency_range(u);
+
+			return edge_storage.subspan(beg, end - beg);
+		}
+
+		[[nodiscard]] auto edge_at(edge_id_type index) const {
+			return edge_storage[offset_of_edge[index]];
+		}
+
+		[[nodiscard]] auto all_vertices() const {
+			return std::views::iota(0, num_vertices());
+		}
+
+		[[nodiscard]] auto all_edges() const {
+			return std::views::iota(edge_id_type(0), edge_id_type(num_edges()))
+				| std::views::transform([this](edge_id_type e) {return edge_at(e);});
+		}
+
+	};
+
+	template<typename VIdxT, typename EIdxT = int>
+	using general_mapped_basic_digraph = general_mapped_basic_graph<VIdxT, EIdxT, true>;
+
+	using mapped_basic_graph = general_mapped_basic_graph<int>;
+	using mapped_basic_digraph = general_mapped_basic_digraph<int>;
+
+	static_assert(graph<mapped_basic_graph>);
+
+}
+
+#endif //GRAPH2X_MAPPED_BASIC_GRAPH_HPP
@@ -0,0 +1,162 @@
+
+#ifndef GRAPH2X_SOA_BASIC_GRAPH_HPP
+#define GRAPH2X_SOA_BASIC_GRAPH_HPP
+
+#include <algorithm>
+#include <vector>
+#include <span>
+
+#include "../core.hpp"
+#include "basic_graph.hpp"
+
+
+namespace g2x {
+
+	/*
+	 * An immutable graph with the same semantics as general_basic_graph, but with adjacency
+	 * stored as a structure of arrays: targets and edge ids of half-edges are kept in separate
+	 * arrays, and the source vertex of each outgoing edge is synthesized from the queried vertex.
+	 *
+	 * A pass over adjacent_vertices only touches the target array, and a pass over outgoing_edges
+	 * reads two thirds of the memory that general_basic_graph would.
+	 *
+	 * Creation: O(V + E), multithreaded with execution::par
+	 * Adjacency check: O(log(N(v)))
+	 * Pass over outgoing_edges: O(N(v))
+	 * Pass over adjacent_vertices: O(N(v))
+	 * Pass over all_vertices: O(V)
+	 * Pass over all_edges: O(E)
+	 * Edge index lookup: O(1)
+	 */
+
+	template<std::integral VIdxT, std::integral EIdxT = int, bool IsDirected = false>
+	class general_soa_basic_graph {
+	public:
+		using vertex_id_type = VIdxT;
+		using edge_id_type = EIdxT;
+		using edge_offset_type = edge_id_type;
+		using edge_value_type = edge_value<vertex_id_type, edge_id_type, IsDirected>;
+
+		static constexpr bool is_directed = IsDirected;
+		static constexpr bool allows_loops = true;
+		static constexpr bool allows_multiple_edges = true;
+
+		static constexpr bool has_natural_vertex_numbering = true;
+		static constexpr bool has_natural_edge_numbering = true;
+		static constexpr bool outgoing_edges_uv_sorted = true;
+		static constexpr bool outgoing_edges_pre_swapped = true;
+
+	private:
+		isize num_vertices_;
+
+		//targets and ids of half-edges, grouped by source vertex
+		std::vector<vertex_id_type> targets_;
+		std::vector<edge_id_type> edge_ids_;
+
+		//the i-th and i+1-th elements denote the index range of targets_ and edge_ids_
+		std::vector<edge_offset_type> adjacency_regions;
+
+		//i-th element is the index into targets_ of one of the half-edges of the edge i
+		std::vector<edge_offset_type> offset_of_edge;
+
+		//i-th element is the source vertex of the half-edge at offset_of_edge[i]
+		std::vector<vertex_id_type> edge_sources_;
+
+		[[nodiscard]] std::pair<edge_offset_type, edge_offset_type> get_adjacency_range(vertex_id_type v) const {
+			return {adjacency_regions.at(v), adjacency_regions.at(v+1)};
+		}
+
+	public:
+
+		general_soa_basic_graph(vertex_count num_vertices, std::ranges::forward_range auto&& edges)
+			: general_soa_basic_graph(execution::seq, num_vertices, std::forward<decltype(edges)>(edges))
+		{
+
+		}
+
+		/*
+		 * With a parallel execution policy, all construction steps after reading the input are multithreaded.
+		 * Reading the input is multithreaded as well if "edges" is a sized random-access range.
+		 */
+		general_soa_basic_graph(
+			const execution::execution_policy auto& policy,
+			vertex_count num_vertices,
+			std::ranges::forward_range auto&& edges)
+		{
+			auto list = detail::collect_csr_half_edges<edge_value_type>(policy, num_vertices, edges);
+			int num_chunks = detail::num_workers_for(policy, list.half_edges.size(), detail::csr_min_half_edges_per_thread);
+
+			num_vertices_ = detail::sort_csr_half_edges(num_chunks, num_vertices, list, adjacency_regions);
+
+			const auto& half_edges = list.half_edges;
+			targets_.resize(half_edges.size());
+			edge_ids_.resize(half_edges.size());
+			offset_of_edge.resize(list.num_edges);
+			edge_sources_.resize(list.num_edges);
+			detail::parallel_for_chunks(num_chunks, half_edges.size(), [&](int, isize begin, isize end) {
+				for(isize k=begin; k<end; k++) {
+					const auto& [u, v, i] = half_edges[k];
+					targets_[k] = v;
+					edge_ids_[k] = i;
+					if(detail::is_representative_half_edge(half_edges[k])) {
+						offset_of_edge[i] = k;
+						edge_sources_[i] = u;
+					}
+				}
+			});
+		}
+
+		[[nodiscard]] isize num_vertices() const {
+			return num_vertices_;
+		}
+
+		[[nodiscard]] isize num_edges() const {
+			return offset_of_edge.size();
+		}
+
+		[[nodiscard]] auto outgoing_edges(vertex_id_type u) const {
+			auto [beg, end] = get_adjacency_range(u);
+
+			return std::views::iota(beg, end)
+				| std::views::transform([this, u](edge_offset_type k) {
+					return edge_value_type{u, targets_[k], edge_ids_[k]};
+				});
+		}
+
+		[[nodiscard]] auto adjacent_vertices(vertex_id_type u) const {
+			auto [beg, end] = get_adjacency_range(u);
+
+			return std::span{targets_.data() + beg, targets_.data() + end};
+		}
+
+		[[nodiscard]] auto edge_at(edge_id_type index) const {
+			return edge_value_type{edge_sources_[index], targets_[offset_of_edge[index]], index};
+		}
+
+		[[nodiscard]] auto all_vertices() const {
+			return std::views::iota(0, num_vertices());
+		}
+
+		[[nodiscard]] auto all_edges() const {
+			return std::views::iota(edge_id_type(0), edge_id_type(num_edges()))
+				| std::views::transform([this](edge_id_type e) {return edge_at(e);});
+		}
+
+	};
+
+	template<typename VIdxT, typename EIdxT = int>
+	using general_soa_basic_digraph = general_soa_basic_graph<VIdxT, EIdxT, true>;
+
+	using soa_basic_graph = general_soa_basic_graph<int>;
+	using soa_basic_graph_16 = general_soa_basic_graph<int16_t>;
+	using soa_basic_graph_8 = general_soa_basic_graph<int8_t>;
+
+	using soa_basic_digraph = general_soa_basic_digraph<int>;
+	using soa_basic_digraph_16 = general_soa_basic_digraph<int16_t>;
+	using soa_basic_digraph_8 = general_soa_basic_digraph<int8_t>;
+
+	static_assert(graph<soa_basic_graph>);
+
+}
+
+#endif //GRAPH2X_SOA_BASIC_GRAPH_HPP
@@ -0,0 +1,480 @@
+
+#ifndef GRAPH2X_IO_EDGE_LIST_HPP
+#define GRAPH2X_IO_EDGE_LIST_HPP
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../core.hpp"
+#include "../execution.hpp"
+#include "../graphs/mapped_basic_graph.hpp"
+
+namespace g2x::io {
+
+	/*
+	 * Supported text edge list formats:
+	 *
+	 * plain          - one "u v" pair per line, separated by whitespace. Further columns
+	 *                  (e.g. weights) are ignored. Lines starting with '#' or '%' are comments.
+	 * csv            - like plain, but values may also be separated by ',' or ';'.
+	 *                  A first line that does not start with a number is treated as a header.
+	 * dimacs         - "p <problem> <n> <m>" problem line, "e u v" or "a u v [w]" edge lines,
+	 *                  "c" comment lines. Vertices are numbered from 1.
+	 * matrix_market  - coordinate Matrix Market file. Rows and columns become the two sides
+	 *                  of a bipartite graph: row i is vertex i-1 and column j is vertex rows+j-1.
+	 *                  Only the stored entries are read, so symmetric matrices yield one triangle.
+	 */
+	enum class edge_list_format {
+		plain,
+		csv,
+		dimacs,
+		matrix_market
+	};
+
+	/*
+	 * Picks the format based on a file extension, defaulting to plain.
+	 */
+	[[nodiscard]] inline edge_list_format guess_edge_list_format(const std::filesystem::path& path) {
+		auto ext = path.extension().string();
+		if(ext == ".csv") {
+			return edge_list_format::csv;
+		} else if(ext == ".mtx" || ext == ".mm") {
+			return edge_list_format::matrix_market;
+		} else if(ext == ".dimacs" || ext == ".gr" || ext == ".col" || ext == ".max") {
+			return edge_list_format::dimacs;
+		}
+		return edge_list_format::plain;
+	}
+
+	struct read_stats {
+		isize num_bytes = 0;
+		isize num_edges = 0;
+
+		// time spent reading the input, including the construction of the graph,
+		// since the two are interleaved when the input is streamed into it
+		double seconds = 0.0;
+
+		[[nodiscard]] double megabytes_per_second() const {
+			return seconds > 0.0 ? double(num_bytes) / 1e6 / seconds : 0.0;
+		}
+	};
+
+	namespace detail {
+
+		/*
+		 * Parses edge lines of a given format. Edges are returned as 0-based vertex indices.
+		 */
+		struct edge_line_parser {
+			edge_list_format format = edge_list_format::plain;
+			const char* file_begin = nullptr;
+			isize index_base = 0;
+			isize target_offset = 0;
+
+			[[nodiscard]] bool is_separator(char c) const {
+				if(c == ' ' || c == '\t' || c == '\r') {
+					return true;
+				}
+				return format == edge_list_format::csv && (c == ',' || c == ';');
+			}
+
+			[[nodiscard]] static const char* find_line_end(const char* pos, const char* end) {
+				auto line_end = static_cast<const char*>(std::memchr(pos, '\n', end - pos));
+				return line_end ? line_end : end;
+			}
+
+			[[noreturn]] void throw_malformed(const char* pos) const {
+				throw std::runtime_error(std::format("malformed edge list line at byte {}", pos - file_begin));
+			}
+
+			isize parse_index(const char*& p, const char* line_end) const {
+				while(p != line_end && is_separator(*p)) {
+					++p;
+				}
+				isize value = 0;
+				auto [next, ec] = std::from_chars(p, line_end, value);
+				if(ec != std::errc{}) {
+					throw_malformed(p);
+				}
+				p = next;
+				return value - index_base;
+			}
+
+			/*
+			 * Parses the line starting at pos and advances pos to the beginning of the next one.
+			 * Returns whether the line contained an edge.
+			 */
+			bool parse_line(const char*& pos, const char* end, std::pair<isize, isize>& edge) const {
+				const char* line_end = find_line_end(pos, end);
+				const char* p = pos;
+				pos = (line_end == end) ? end : line_end + 1;
+
+				while(p != line_end && is_separator(*p)) {
+					++p;
+				}
+				if(p == line_end || *p == '#' || *p == '%') {
+					return false;
+				}
+				if(format == edge_list_format::dimacs) {
+					// node lines, e.g. the source and sink of max-flow problems, do not describe edges
+					if(*p == 'c' || *p == 'p' || *p == 'n') {
+						return false;
+					} else if(*p == 'e' || *p == 'a') {
+						++p;
+					} else {
+						throw_malformed(p);
+					}
+				}
+
+				edge.first = parse_index(p, line_end);
+				edge.second = parse_index(p, line_end) + target_offset;
+				return true;
+			}
+		};
+
+		// parses the whitespace-separated integers of a header line
+		inline std::vector<isize> parse_header_numbers(std::string_view line) {
+			std::vector<isize> result;
+			const char* p = line.data();
+			const char* end = line.data() + line.size();
+			while(p != end) {
+				if(*p == ' ' || *p == '\t' || *p == '\r') {
+					++p;
+					continue;
+				}
+				isize value = 0;
+				auto [next, ec] = std::from_chars(p, end, value);
+				if(ec != std::errc{}) {
+					break;
+				}
+				result.push_back(value);
+				p = next;
+			}
+			return result;
+		}
+
+	}
+
+	/*
+	 * A forward iterator parsing edges from a buffer line by line.
+	 */
+	class edge_list_iterator {
+	public:
+		using value_type = std::pair<isize, isize>;
+		using difference_type = std::ptrdiff_t;
+		using iterator_concept = std::forward_iterator_tag;
+
+		edge_list_iterator() = default;
+
+		edge_list_iterator(const detail::edge_line_parser& parser, const char* begin, const char* end)
+			: parser_(parser), next_(begin), end_(end)
+		{
+			advance();
+		}
+
+		[[nodiscard]] value_type operator*() const {
+			return current_;
+		}
+
+		edge_list_iterator& operator++() {
+			advance();
+			return *this;
+		}
+
+		edge_list_iterator operator++(int) {
+			auto result = *this;
+			++*this;
+			return result;
+		}
+
+		friend bool operator==(const edge_list_iterator& a, const edge_list_iterator& b) {
+			return a.next_ == b.next_ && a.at_end_ == b.at_end_;
+		}
+
+		friend bool operator==(const edge_list_iterator& it, std::default_sentinel_t) {
+			return it.at_end_;
+		}
+
+	private:
+		detail::edge_line_parser parser_;
+		const char* next_ = nullptr;
+		const char* end_ = nullptr;
+		bool at_end_ = true;
+		value_type current_ {};
+
+		void advance() {
+			while(next_ != end_) {
+				if(parser_.parse_line(next_, end_, current_)) {
+					at_end_ = false;
+					return;
+				}
+			}
+			at_end_ = true;
+		}
+	};
+
+	/*
+	 * A memory-mapped text edge list file.
+	 */
+	class edge_list_file {
+	public:
+		edge_list_file(const std::filesystem::path& path, edge_list_format format)
+			: file_(path)
+		{
+			parser_.format = format;
+			parser_.file_begin = reinterpret_cast<const char*>(file_.data());
+			data_begin_ = parser_.file_begin;
+			data_end_ = parser_.file_begin + file_.size();
+
+			switch(format) {
+				case edge_list_format::plain:
+					break;
+				case edge_list_format::csv:
+					read_csv_header();
+					break;
+				case edge_list_format::dimacs:
+					read_dimacs_header();
+					break;
+				case edge_list_format::matrix_market:
+					read_matrix_market_header(path);
+					break;
+			}
+		}
+
+		explicit edge_list_file(const std::filesystem::path& path)
+			: edge_list_file(path, guess_edge_list_format(path))
+		{
+
+		}
+
+		/*
+		 * The number of vertices declared in the header of the file, if the format has one.
+		 */
+		[[nodiscard]] std::optional<isize> declared_num_vertices() const {
+			return declared_num_vertices_;
+		}
+
+		[[nodiscard]] isize size_bytes() const {
+			return file_.size();
+		}
+
+		/*
+		 * A lazy range of edges parsed on the fly from the file.
+		 */
+		[[nodiscard]] auto edges() const {
+			return std::ranges::subrange(edge_list_iterator(parser_, data_begin_, data_end_), std::default_sentinel);
+		}
+
+		/*
+		 * Parses the file on multiple threads into a single buffer of edges in file order.
+		 * The data is split into num_chunks parts at line boundaries. Each part is parsed into
+		 * its own slice of the buffer, sized by its number of lines, and the slices are then
+		 * moved together.
+		 */
+		template<typename VIdxT = isize>
+		[[nodiscard]] std::vector<std::pair<VIdxT, VIdxT>> parse_edges(int num_chunks) const {
+			std::vector<const char*> bounds(num_chunks + 1);
+			bounds[0] = data_begin_;
+			bounds[num_chunks] = data_end_;
+			for(int c=1; c<num_chunks; c++) {
+				auto [begin, end] = g2x::detail::chunk_bounds(data_end_ - data_begin_, num_chunks, c);
+				const char* pos = std::max(data_begin_ + begin, bounds[c-1]);
+				const char* line_end = detail::edge_line_parser::find_line_end(pos, data_end_);
+				bounds[c] = (line_end == data_end_) ? data_end_ : line_end + 1;
+			}
+
+			// every line holds at most one edge, and the last one may lack a line break
+			std::vector<isize> slice_offsets(num_chunks + 1, 0);
+			g2x::detail::run_workers(num_chunks, [&](int chunk) {
+				slice_offsets[chunk + 1] = std::count(bounds[chunk], bounds[chunk+1], '\n') + 1;
+			});
+			for(int c=0; c<num_chunks; c++) {
+				slice_offsets[c+1] += slice_offsets[c];
+			}
+
+			std::vector<std::pair<VIdxT, VIdxT>> result(slice_offsets.back());
+			std::vector<isize> slice_sizes(num_chunks, 0);
+			g2x::detail::run_workers(num_chunks, [&](int chunk) {
+				auto out = result.begin() + slice_offsets[chunk];
+				const char* pos = bounds[chunk];
+				std::pair<isize, isize> edge;
+				while(pos != bounds[chunk+1]) {
+					if(parser_.parse_line(pos, bounds[chunk+1], edge)) {
+						*out++ = {VIdxT(edge.first), VIdxT(edge.second)};
+					}
+				}
+				slice_sizes[chunk] = out - (result.begin() + slice_offsets[chunk]);
+			});
+
+			// slices only move towards the front, so moving them in order never overwrites one
+			auto result_end = result.begin();
+			for(int c=0; c<num_chunks; c++) {
+				auto slice_begin = result.begin() + slice_offsets[c];
+				result_end = std::copy(slice_begin, slice_begin + slice_sizes[c], result_end);
+			}
+			result.erase(result_end, result.end());
+			return result;
+		}
+
+	private:
+		g2x::detail::mapped_file file_;
+		detail::edge_line_parser parser_;
+		const char* data_begin_ = nullptr;
+		const char* data_end_ = nullptr;
+		std::optional<isize> declared_num_vertices_;
+
+		// returns the next line that is not empty and is not a comment, advancing data_begin_ past it
+		std::optional<std::string_view> next_significant_line(std::string_view comment_prefixes) {
+			while(data_begin_ != data_end_) {
+				const char* line_end = detail::edge_line_parser::find_line_end(data_begin_, data_end_);
+				std::string_view line(data_begin_, line_end);
+				data_begin_ = (line_end == data_end_) ? data_end_ : line_end + 1;
+
+				auto first = line.find_first_not_of(" \t\r");
+				if(first != std::string_view::npos && comment_prefixes.find(line[first]) == std::string_view::npos) {
+					return line.substr(first);
+				}
+			}
+			return std::nullopt;
+		}
+
+		void read_csv_header() {
+			const char* saved_begin = data_begin_;
+			auto line = next_significant_line("#%");
+			bool is_header = line && not (std::isdigit(static_cast<unsigned char>(line->front())) || line->front() == '-');
+			if(not is_header) {
+				data_begin_ = saved_begin;
+			}
+		}
+
+		void read_dimacs_header() {
+			// the problem line usually precedes all edges, but edge lines are parsed independently of it
+			const char* saved_begin = data_begin_;
+			while(auto line = next_significant_line("c")) {
+				if(line->front() == 'p') {
+					auto problem = line->substr(1);
+					auto numbers_begin = problem.find_first_of("0123456789");
+					if(numbers_begin != std::string_view::npos) {
+						auto numbers = detail::parse_header_numbers(problem.substr(numbers_begin));
+						if(not numbers.empty()) {
+							declared_num_vertices_ = numbers[0];
+						}
+					}
+					break;
+				}
+				if(line->front() == 'e' || line->front() == 'a') {
+					break;
+				}
+			}
+			data_begin_ = saved_begin;
+			parser_.index_base = 1;
+		}
+
+		void read_matrix_market_header(const std::filesystem::path& path) {
+			std::string_view banner = "%%MatrixMarket";
+			if(file_.size() < banner.size() || std::string_view(data_begin_, banner.size()) != banner) {
+				throw std::runtime_error(std::format("{}: missing Matrix Market banner", path.string()));
+			}
+			auto banner_line = std::string_view(data_begin_, detail::edge_line_parser::find_line_end(data_begin_, data_end_));
+			if(banner_line.find("coordinate") == std::string_view::npos) {
+				throw std::runtime_error(std::format("{}: only coordinate Matrix Market files describe graphs", path.string()));
+			}
+
+			auto size_line = next_significant_line("%");
+			auto sizes = size_line ? detail::parse_header_numbers(*size_line) : std::vector<isize>{};
+			if(sizes.size() < 3) {
+				throw std::runtime_error(std::format("{}: malformed Matrix Market size line", path.string()));
+			}
+			declared_num_vertices_ = sizes[0] + sizes[1];
+			parser_.index_base = 1;
+			parser_.target_offset = sizes[0];
+		}
+	};
+
+	/*
+	 * Reads a graph from a text edge list.
+	 *
+	 * With a sequential policy, edges are parsed lazily while the graph is being constructed,
+	 * without an intermediate edge buffer. With a parallel policy, the file is parsed by
+	 * multiple threads into a single edge buffer, which is passed to create_graph along
+	 * with the policy, so that the graph is constructed in parallel as well.
+	 */
+	template<typename GraphT>
+	GraphT read_graph(
+		const std::filesystem::path& path,
+		edge_list_format format,
+		const execution::execution_policy auto& policy,
+		read_stats* stats = nullptr)
+	{
+		using clock = std::chrono::steady_clock;
+		auto start_time = clock::now();
+
+		edge_list_file file(path, format);
+		auto num_vertices = file.declared_num_vertices();
+		isize num_read_edges = 0;
+
+		auto build = [&](auto&& edges) {
+			if(num_vertices.has_value()) {
+				return create_graph<GraphT>(policy, *num_vertices, edges);
+			} else {
+				return create_graph<GraphT>(policy, edges);
+			}
+		};
+
+		auto read = [&]() {
+			int num_chunks = g2x::detail::num_workers_for(policy, file.size_bytes(), 1 << 20);
+			if(num_chunks > 1) {
+				auto edges = file.parse_edges<vertex_id_t<GraphT>>(num_chunks);
+				num_read_edges = std::ssize(edges);
+				return build(edges);
+			}
+
+			auto counted_edges = file.edges() | std::views::transform([&](const auto& edge) {
+				++num_read_edges;
+				return edge;
+			});
+			using counted_edges_type = decltype(counted_edges);
+			constexpr bool is_built_in_one_pass = requires(counted_edges_type edges) {GraphT(policy, edges);}
+				|| requires(counted_edges_type edges) {GraphT(policy, auto_num_vertices, edges);}
+				|| requires(counted_edges_type edges) {GraphT(edges);};
+			if(num_vertices.has_value() || is_built_in_one_pass) {
+				return build(counted_edges);
+			}
+			// create_graph would pass over the edges twice to find the number of vertices first
+			auto edges = counted_edges | std::ranges::to<std::vector>();
+			return build(edges);
+		};
+
+		auto graph = read();
+		if(stats) {
+			stats->seconds = std::chrono::duration<double>(clock::now() - start_time).count();
+			stats->num_bytes = file.size_bytes();
+			stats->num_edges = num_read_edges;
+		}
+		return graph;
+	}
+
+	template<typename GraphT>
+	GraphT read_graph(const std::filesystem::path& path, edge_list_format format, read_stats* stats = nullptr) {
+		return read_graph<GraphT>(path, format, execution::seq, stats);
+	}
+
+	template<typename GraphT>
+	GraphT read_graph(const std::filesystem::path& path, read_stats* stats = nullptr) {
+		return read_graph<GraphT>(path, guess_edge_list_format(path), execution::seq, stats);
+	}
+
+}
+
+#endif //GRAPH2X_IO_EDGE_LIST_HPP
@@ -0,0 +1,7 @@
+
+#ifndef GRAPH2X_IO_HPP
+#define GRAPH2X_IO_HPP
+
+#include "edge_list.hpp"
+
+#endif //GRAPH2X_IO_HPP
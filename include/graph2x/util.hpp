@@ -2,8 +2,18 @@
 #ifndef GRAPH2X_UTIL_HPP
 #define GRAPH2X_UTIL_HPP
 
+#include <bit>
+#include <cstdint>
+#include <cstring>
 #include <format>
+#include <iterator>
+#include <new>
+#include <ranges>
+#include <span>
+#include <type_traits>
 #include <utility>
+#include <variant>
+#include <vector>
 
 namespace g2x {
 
@@ -36,6 +46,267 @@ namespace g2x {
 				});
 		}
 
+		/*
+		 * A forward iterator over the indices of the nonzero bytes in a row, examining 8 bytes at a time.
+		 * Compares equal to std::default_sentinel once the end of the row is reached.
+		 */
+		class nonzero_byte_index_iterator {
+		public:
+			using value_type = isize;
+			using difference_type = std::ptrdiff_t;
+			using iterator_concept = std::forward_iterator_tag;
+
+			nonzero_byte_index_iterator() = default;
+
+			nonzero_byte_index_iterator(const char* row, isize size)
+				: row_(row), size_(size), pos_(find_next(0)) {
+
+			}
+
+			[[nodiscard]] isize operator*() const {
+				return pos_;
+			}
+
+			nonzero_byte_index_iterator& operator++() {
+				pos_ = find_next(pos_ + 1);
+				return *this;
+			}
+
+			nonzero_byte_index_iterator operator++(int) {
+				auto result = *this;
+				++*this;
+				return result;
+			}
+
+			friend bool operator==(const nonzero_byte_index_iterator& a, const nonzero_byte_index_iterator& b) {
+				return a.pos_ == b.pos_;
+			}
+
+			friend bool operator==(const nonzero_byte_index_iterator& it, std::default_sentinel_t) {
+				return it.pos_ == it.size_;
+			}
+
+		private:
+			const char* row_ = nullptr;
+			isize size_ = 0;
+			isize pos_ = 0;
+
+			[[nodiscard]] isize find_next(isize i) const {
+				for(; i + 8 <= size_; i += 8) {
+					std::uint64_t word;
+					std::memcpy(&word, row_ + i, sizeof(word));
+					if(word != 0) {
+						if constexpr(std::endian::native == std::endian::little) {
+							return i + std::countr_zero(word) / 8;
+						} else {
+							return i + std::countl_zero(word) / 8;
+						}
+					}
+				}
+				while(i < size_ && row_[i] == 0) {
+					++i;
+				}
+				return i;
+			}
+		};
+
+		/*
+		 * A range of the indices of the nonzero bytes in a row.
+		 */
+		inline auto nonzero_byte_indices(const char* row, isize size) {
+			return std::ranges::subrange(nonzero_byte_index_iterator(row, size), std::default_sentinel);
+		}
+
+		/*
+		 * A forward iterator over the indices of the set bits in a sequence of 64-bit words.
+		 * Compares equal to std::default_sentinel after the last set bit.
+		 */
+		class set_bit_index_iterator {
+		public:
+			using value_type = isize;
+			using difference_type = std::ptrdiff_t;
+			using iterator_concept = std::forward_iterator_tag;
+
+			set_bit_index_iterator() = default;
+
+			set_bit_index_iterator(const std::uint64_t* words, isize num_words)
+				: words_(words), num_words_(num_words), word_index_(-1) {
+				advance();
+			}
+
+			[[nodiscard]] isize operator*() const {
+				return pos_;
+			}
+
+			set_bit_index_iterator& operator++() {
+				advance();
+				return *this;
+			}
+
+			set_bit_index_iterator operator++(int) {
+				auto result = *this;
+				++*this;
+				return result;
+			}
+
+			friend bool operator==(const set_bit_index_iterator& a, const set_bit_index_iterator& b) {
+				return a.pos_ == b.pos_;
+			}
+
+			friend bool operator==(const set_bit_index_iterator& it, std::default_sentinel_t) {
+				return it.word_index_ >= it.num_words_;
+			}
+
+		private:
+			const std::uint64_t* words_ = nullptr;
+			isize num_words_ = 0;
+			isize word_index_ = 0;
+			std::uint64_t remaining_bits_ = 0;
+			isize pos_ = 0;
+
+			void advance() {
+				while(remaining_bits_ == 0) {
+					if(++word_index_ >= num_words_) {
+						pos_ = num_words_ * 64;
+						return;
+					}
+					remaining_bits_ = words_[word_index_];
+				}
+				pos_ = word_index_ * 64 + std::countr_zero(remaining_bits_);
+				remaining_bits_ &= remaining_bits_ - 1;
+			}
+		};
+
+		/*
+		 * A range of the indices of the set bits in a sequence of 64-bit words.
+		 */
+		inline auto set_bit_indices(std::span<const std::uint64_t> words) {
+			return std::ranges::subrange(set_bit_index_iterator(words.data(), words.size()), std::default_sentinel);
+		}
+
+		/*
+		 * A range that is one of two range types, chosen at runtime. Lets a function
+		 * return differently typed ranges from different branches, e.g. adjacency lists
+		 * that are built in different ways for different vertices.
+		 *
+		 * Both ranges must have the same value type. Like std::ranges::filter_view,
+		 * this can only be iterated when it is not const.
+		 */
+		template<std::ranges::view FirstT, std::ranges::view SecondT>
+			requires std::same_as<std::ranges::range_value_t<FirstT>, std::ranges::range_value_t<SecondT>>
+		class either_view : public std::ranges::view_interface<either_view<FirstT, SecondT>> {
+		public:
+			class iterator {
+			public:
+				using value_type = std::ranges::range_value_t<FirstT>;
+				using difference_type = std::ptrdiff_t;
+				using iterator_concept = std::forward_iterator_tag;
+
+				iterator() = default;
+
+				template<std::size_t Index>
+				iterator(std::in_place_index_t<Index> index, auto current, auto end)
+					: state_(index, std::move(current), std::move(end))
+				{}
+
+				[[nodiscard]] value_type operator*() const {
+					return std::visit([](const auto& state) -> value_type {return *state.current;}, state_);
+				}
+
+				iterator& operator++() {
+					std::visit([](auto& state) {++state.current;}, state_);
+					return *this;
+				}
+
+				iterator operator++(int) {
+					auto result = *this;
+					++*this;
+					return result;
+				}
+
+				friend bool operator==(const iterator& a, const iterator& b) {
+					if(a.state_.index() != b.state_.index()) {
+						return false;
+					}
+					if(a.state_.index() == 0) {
+						return std::get<0>(a.state_).current == std::get<0>(b.state_).current;
+					} else {
+						return std::get<1>(a.state_).current == std::get<1>(b.state_).current;
+					}
+				}
+
+				friend bool operator==(const iterator& it, std::default_sentinel_t) {
+					return std::visit([](const auto& state) {return state.current == state.end;}, it.state_);
+				}
+
+			private:
+				template<typename RangeT>
+				struct position {
+					std::ranges::iterator_t<RangeT> current;
+					std::ranges::sentinel_t<RangeT> end;
+
+					position() = default;
+					position(auto current, auto end) : current(std::move(current)), end(std::move(end)) {}
+				};
+
+				std::variant<position<FirstT>, position<SecondT>> state_;
+			};
+
+			either_view() = default;
+
+			template<std::size_t Index>
+			either_view(std::in_place_index_t<Index> index, auto&& range)
+				: range_(index, std::forward<decltype(range)>(range))
+			{}
+
+			[[nodiscard]] iterator begin() {
+				if(range_.index() == 0) {
+					auto& range = std::get<0>(range_);
+					return iterator(std::in_place_index<0>, std::ranges::begin(range), std::ranges::end(range));
+				} else {
+					auto& range = std::get<1>(range_);
+					return iterator(std::in_place_index<1>, std::ranges::begin(range), std::ranges::end(range));
+				}
+			}
+
+			[[nodiscard]] std::default_sentinel_t end() {
+				return std::default_sentinel;
+			}
+
+		private:
+			std::variant<FirstT, SecondT> range_;
+		};
+
+		/*
+		 * Minimal allocator returning memory aligned to Alignment bytes.
+		 */
+		template<typename T, std::size_t Alignment>
+		struct aligned_allocator {
+			using value_type = T;
+
+			template<typename U>
+			struct rebind {
+				using other = aligned_allocator<U, Alignment>;
+			};
+
+			aligned_allocator() = default;
+
+			template<typename U>
+			aligned_allocator(const aligned_allocator<U, Alignment>&) {}
+
+			[[nodiscard]] T* allocate(std::size_t n) {
+				return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+			}
+
+			void deallocate(T* p, std::size_t n) {
+				::operator delete(p, n * sizeof(T), std::align_val_t(Alignment));
+			}
+
+			friend bool operator==(const aligned_allocator&, const aligned_allocator&) {
+				return true;
+			}
+		};
+
 		struct always_true {
 			template<typename... Ts>
 			bool operator()(Ts&&...) {
@@ -51,6 +322,117 @@ namespace g2x {
 		};
 	}
 
+	/*
+	 * A matrix of bits stored row by row in 64-bit words. Each row is padded to a whole
+	 * number of cache lines, and the storage is cache line aligned, so rows can be processed
+	 * word by word (or with wider vector loads) without edge cases. Padding bits are always zero.
+	 */
+	class bit_matrix {
+	public:
+		using word_type = std::uint64_t;
+
+		static constexpr isize bits_per_word = 64;
+		static constexpr isize alignment = 64;
+		static constexpr isize words_per_alignment = alignment / sizeof(word_type);
+
+		bit_matrix() = default;
+
+		bit_matrix(isize num_rows, isize num_cols)
+			: num_rows_(num_rows),
+			  num_cols_(num_cols),
+			  words_per_row_((num_cols + bits_per_word * words_per_alignment - 1) / (bits_per_word * words_per_alignment) * words_per_alignment),
+			  words_(num_rows * words_per_row_, 0)
+		{
+
+		}
+
+		[[nodiscard]] isize num_rows() const {
+			return num_rows_;
+		}
+
+		[[nodiscard]] isize num_cols() const {
+			return num_cols_;
+		}
+
+		[[nodiscard]] isize words_per_row() const {
+			return words_per_row_;
+		}
+
+		[[nodiscard]] bool get(isize row, isize col) const {
+			bounds_check(row, col);
+			return (words_[word_offset(row, col)] >> (col % bits_per_word)) & 1;
+		}
+
+		void set(isize row, isize col, bool value) {
+			bounds_check(row, col);
+			word_type mask = word_type(1) << (col % bits_per_word);
+			if(value) {
+				words_[word_offset(row, col)] |= mask;
+			} else {
+				words_[word_offset(row, col)] &= ~mask;
+			}
+		}
+
+		[[nodiscard]] std::span<const word_type> row_words(isize row) const {
+			return {words_.data() + row * words_per_row_, std::size_t(words_per_row_)};
+		}
+
+		[[nodiscard]] std::span<word_type> row_words(isize row) {
+			return {words_.data() + row * words_per_row_, std::size_t(words_per_row_)};
+		}
+
+		/*
+		 * Returns a range of the column indices of the set bits in a row.
+		 */
+		[[nodiscard]] auto row_set_bits(isize row) const {
+			return detail::set_bit_indices(row_words(row));
+		}
+
+		[[nodiscard]] isize row_popcount(isize row) const {
+			isize result = 0;
+			for(word_type w: row_words(row)) {
+				result += std::popcount(w);
+			}
+			return result;
+		}
+
+		/*
+		 * Returns the number of columns set in both of the two rows.
+		 */
+		[[nodiscard]] isize common_popcount(isize row1, isize row2) const {
+			auto w1 = row_words(row1);
+			auto w2 = row_words(row2);
+			isize result = 0;
+			for(isize i=0; i<words_per_row_; i++) {
+				result += std::popcount(w1[i] & w2[i]);
+			}
+			return result;
+		}
+
+		[[nodiscard]] const word_type* data() const {
+			return words_.data();
+		}
+
+	private:
+		isize num_rows_ = 0;
+		isize num_cols_ = 0;
+		isize words_per_row_ = 0;
+		std::vector<word_type, detail::aligned_allocator<word_type, alignment>> words_;
+
+		[[nodiscard]] isize word_offset(isize row, isize col) const {
+			return row * words_per_row_ + col / bits_per_word;
+		}
+
+		void bounds_check(isize row, isize col) const {
+			if(row < 0 || row >= num_rows_ || col < 0 || col >= num_cols_) {
+				throw std::out_of_range(std::format(
+					"element ({},{}) is out of bounds of this {}x{} bit matrix",
+					row, col, num_rows_, num_cols_
+				));
+			}
+		}
+	};
+
 	template<typename T>
 	class array_2d {
 	public:
@@ -0,0 +1,302 @@
+#include "tests_common.hpp"
+
+#include <random>
+
+namespace {
+
+	auto random_bipartite_graph(int num_vertices_per_side, double average_degree, std::uint64_t seed) {
+		std::mt19937_64 rng(seed);
+		return g2x::create_graph<g2x::basic_graph>(g2x::graph_gen::average_degree_bipartite_generator(num_vertices_per_side, num_vertices_per_side, average_degree, rng));
+	}
+
+	int matching_size(const auto& graph, const auto& matching) {
+		int result = 0;
+		for(const auto& [u, v, i]: g2x::all_edges(graph)) {
+			result += bool(matching[i]);
+		}
+		return result;
+	}
+
+	TEST(bip_matchings, parallel_hopcroft_karp_finds_maximum_matching) {
+		for(double average_degree: {1.5, 3.0, 8.0}) {
+			auto graph = random_bipartite_graph(40000, average_degree, 317);
+			auto reference = g2x::algo::max_bipartite_matching(graph);
+			auto matching = g2x::algo::max_bipartite_matching(g2x::execution::par(4), graph);
+
+			EXPECT_TRUE(g2x::algo::is_edge_set_matching(graph, matching));
+			EXPECT_EQ(matching_size(graph, matching), matching_size(graph, reference)) << "average degree " << average_degree;
+		}
+	}
+
+	TEST(bip_matchings, push_relabel_finds_maximum_matching) {
+		for(double average_degree: {1.5, 3.0, 8.0}) {
+			auto graph = random_bipartite_graph(3000, average_degree, 318);
+			auto reference = g2x::algo::max_bipartite_matching(graph);
+			auto matching = g2x::algo::push_relabel_max_bipartite_matching(graph);
+
+			EXPECT_TRUE(g2x::algo::is_edge_set_matching(graph, matching));
+			EXPECT_EQ(matching_size(graph, matching), matching_size(graph, reference)) << "average degree " << average_degree;
+		}
+	}
+
+	TEST(bip_matchings, pothen_fan_finds_maximum_matching) {
+		for(double average_degree: {1.5, 3.0, 8.0}) {
+			auto graph = random_bipartite_graph(40000, average_degree, 319);
+			auto reference = g2x::algo::max_bipartite_matching(graph);
+			auto matching = g2x::algo::pothen_fan_max_bipartite_matching(graph);
+			auto parallel_matching = g2x::algo::pothen_fan_max_bipartite_matching(g2x::execution::par(4), graph);
+
+			EXPECT_TRUE(g2x::algo::is_edge_set_matching(graph, matching));
+			EXPECT_TRUE(g2x::algo::is_edge_set_matching(graph, parallel_matching));
+			EXPECT_EQ(matching_size(graph, matching), matching_size(graph, reference)) << "average degree " << average_degree;
+			EXPECT_EQ(matching_size(graph, parallel_matching), matching_size(graph, reference)) << "average degree " << average_degree;
+		}
+	}
+
+	TEST(bip_matchings, greedy_matchings_are_maximal) {
+		auto graph = random_bipartite_graph(2000, 3.0, 320);
+		for(const auto& matching: {
+			g2x::algo::greedy_maximal_matching(graph),
+			g2x::algo::karp_sipser_matching(graph),
+			g2x::algo::min_degree_greedy_matching(graph)
+		}) {
+			EXPECT_TRUE(g2x::algo::is_edge_set_matching(graph, matching));
+
+			auto matched_vertices = g2x::create_vertex_property<g2x::boolean>(graph, false);
+			for(const auto& [u, v, i]: g2x::all_edges(graph)) {
+				if(matching[i]) {
+					matched_vertices[u] = matched_vertices[v] = true;
+				}
+			}
+			for(const auto& [u, v, i]: g2x::all_edges(graph)) {
+				EXPECT_TRUE(matched_vertices[u] || matched_vertices[v]) << "edge " << i << " could be added";
+			}
+		}
+	}
+
+	TEST(bip_matchings, warm_started_hopcroft_karp_finds_maximum_matching) {
+		auto graph = random_bipartite_graph(5000, 3.0, 321);
+		auto reference = g2x::algo::max_bipartite_matching(graph);
+		auto matching = g2x::algo::max_bipartite_matching(graph, g2x::algo::karp_sipser_matching(graph));
+
+		EXPECT_TRUE(g2x::algo::is_edge_set_matching(graph, matching));
+		EXPECT_EQ(matching_size(graph, matching), matching_size(graph, reference));
+
+		auto all_edges = g2x::create_edge_property<g2x::boolean>(graph, true);
+		EXPECT_THROW(std::ignore = g2x::algo::max_bipartite_matching(graph, all_edges), std::invalid_argument);
+	}
+
+	TEST(bip_matchings, hopcroft_karp_follows_very_long_augmenting_path) {
+		// a path 0 - 1 - ... - 2n-1 with every other inner edge matched, which leaves a single
+		// augmenting path through all vertices, far deeper than the call stack allows recursing
+		int num_path_vertices = 400000;
+		std::vector<std::pair<int, int>> edges;
+		for(int v=0; v+1<num_path_vertices; v++) {
+			edges.emplace_back(v, v + 1);
+		}
+		auto graph = g2x::create_graph<g2x::basic_graph>(num_path_vertices, edges);
+
+		auto initial_matching = g2x::create_edge_property<g2x::boolean>(graph, false);
+		for(const auto& [u, v, i]: g2x::all_edges(graph)) {
+			initial_matching[i] = std::min(u, v) % 2 == 1;
+		}
+		auto matching = g2x::algo::max_bipartite_matching(graph, initial_matching);
+
+		EXPECT_TRUE(g2x::algo::is_edge_set_matching(graph, matching));
+		EXPECT_EQ(matching_size(graph, matching), num_path_vertices / 2);
+		EXPECT_EQ(g2x::algo::insights::hopcroft_karp.longest_augmenting_path, num_path_vertices - 1);
+	}
+
+	TEST(bip_matchings, hopcroft_karp_workspace_is_reusable) {
+		g2x::algo::hopcroft_karp_workspace<g2x::basic_graph> workspace;
+		for(auto [num_vertices_per_side, seed]: {std::pair{3000, 328}, {3000, 329}, {1000, 330}}) {
+			auto graph = random_bipartite_graph(num_vertices_per_side, 3.0, seed);
+			auto matching = g2x::algo::max_bipartite_matching(graph, workspace);
+
+			EXPECT_TRUE(g2x::algo::is_edge_set_matching(graph, matching));
+			EXPECT_TRUE(g2x::algo::is_edge_set_maximum_matching(graph, matching));
+		}
+	}
+
+	TEST(bip_matchings, near_cubic_hopcroft_karp_finds_maximum_matching) {
+		for(double average_degree: {1.5, 3.0}) {
+			auto graph = random_bipartite_graph(3000, average_degree, 331);
+			auto reference = g2x::algo::max_bipartite_matching(graph);
+			auto matching = g2x::algo::near_cubic_max_bipartite_matching(graph);
+
+			EXPECT_TRUE(g2x::algo::is_edge_set_matching(graph, matching));
+			EXPECT_EQ(matching_size(graph, matching), matching_size(graph, reference)) << "average degree " << average_degree;
+		}
+	}
+
+	TEST(bip_matchings, incremental_matching_stays_maximum) {
+		std::mt19937_64 rng(322);
+		auto edges = g2x::graph_gen::average_degree_bipartite_generator(500, 500, 2.5, rng) | std::ranges::to<std::vector>();
+		auto initial_edges = std::span(edges).first(edges.size() / 2);
+
+		auto graph = g2x::create_graph<g2x::dynamic_graph>(initial_edges);
+		g2x::algo::incremental_bipartite_matching incremental(graph);
+
+		auto expect_maximum = [&]() {
+			auto matching = incremental.matching();
+			EXPECT_TRUE(g2x::algo::is_edge_set_matching(graph, matching));
+			EXPECT_EQ(incremental.size(), matching_size(graph, g2x::algo::max_bipartite_matching(graph)));
+		};
+		expect_maximum();
+
+		std::vector<g2x::edge_id_t<g2x::dynamic_graph>> created;
+		for(const auto& [u, v]: std::span(edges).subspan(edges.size() / 2)) {
+			created.push_back(incremental.create_edge(u, v));
+		}
+		expect_maximum();
+
+		for(std::size_t k=0; k<created.size(); k+=3) {
+			EXPECT_TRUE(incremental.remove_edge(created[k]));
+		}
+		expect_maximum();
+		EXPECT_FALSE(incremental.remove_edge(created[0]));
+	}
+
+	TEST(bip_matchings, incremental_matching_rejects_odd_cycles) {
+		auto graph = g2x::create_graph<g2x::nested_vec_graph>(4, std::vector<std::pair<int, int>>{{0, 1}, {2, 3}});
+		g2x::algo::incremental_bipartite_matching incremental(graph);
+		EXPECT_EQ(incremental.size(), 2);
+
+		// joins two components, which flips the sides of one of them
+		incremental.create_edge(1, 3);
+		EXPECT_NE(incremental.side(1), incremental.side(3));
+		EXPECT_THROW(incremental.create_edge(0, 3), std::invalid_argument);
+	}
+
+	long long matching_weight(const auto& graph, const auto& matching, const auto& weights) {
+		long long result = 0;
+		for(const auto& [u, v, i]: g2x::all_edges(graph)) {
+			if(matching[i]) {
+				result += weights[i];
+			}
+		}
+		return result;
+	}
+
+	TEST(bip_matchings, max_weight_matching_matches_brute_force) {
+		std::mt19937_64 rng(323);
+		for(int round=0; round<20; round++) {
+			auto graph = random_bipartite_graph(6, 2.0, rng());
+			auto weights = g2x::create_edge_property<int>(graph, 0);
+			for(const auto& [u, v, i]: g2x::all_edges(graph)) {
+				weights[i] = std::uniform_int_distribution(-5, 20)(rng);
+			}
+
+			long long best = 0;
+			auto num_edges = g2x::num_edges(graph);
+			ASSERT_LE(num_edges, 20);
+			for(std::uint32_t subset=0; subset < (1u << num_edges); subset++) {
+				auto candidate = g2x::create_edge_property<g2x::boolean>(graph, false);
+				for(int i=0; i<num_edges; i++) {
+					candidate[i] = (subset >> i) & 1;
+				}
+				if(g2x::algo::is_edge_set_matching(graph, candidate)) {
+					best = std::max(best, matching_weight(graph, candidate, weights));
+				}
+			}
+
+			auto hungarian = g2x::algo::max_weight_bipartite_matching(graph, weights);
+			auto auction = g2x::algo::auction_max_weight_bipartite_matching(graph, weights);
+			EXPECT_TRUE(g2x::algo::is_edge_set_matching(graph, hungarian));
+			EXPECT_TRUE(g2x::algo::is_edge_set_matching(graph, auction));
+			EXPECT_EQ(matching_weight(graph, hungarian, weights), best);
+			EXPECT_EQ(matching_weight(graph, auction, weights), best);
+		}
+	}
+
+	TEST(bip_matchings, auction_agrees_with_hungarian) {
+		std::mt19937_64 rng(324);
+		auto graph = random_bipartite_graph(3000, 4.0, 325);
+		auto weights = g2x::create_edge_property<long long>(graph, 0);
+		for(const auto& [u, v, i]: g2x::all_edges(graph)) {
+			weights[i] = std::uniform_int_distribution<long long>(1, 1000)(rng);
+		}
+
+		auto hungarian = g2x::algo::max_weight_bipartite_matching(graph, weights);
+		auto auction = g2x::algo::auction_max_weight_bipartite_matching(g2x::execution::par(4), graph, weights);
+		EXPECT_EQ(matching_weight(graph, auction, weights), matching_weight(graph, hungarian, weights));
+	}
+
+	TEST(bip_matchings, parallel_auction_agrees_with_sequential) {
+		// enough bidders per round for the bidding to be split between the workers
+		std::mt19937_64 rng(332);
+		auto graph = random_bipartite_graph(30000, 4.0, 333);
+		auto weights = g2x::create_edge_property<long long>(graph, 0);
+		for(const auto& [u, v, i]: g2x::all_edges(graph)) {
+			weights[i] = std::uniform_int_distribution<long long>(1, 1000)(rng);
+		}
+
+		auto sequential = g2x::algo::auction_max_weight_bipartite_matching(g2x::execution::seq, graph, weights);
+		auto parallel = g2x::algo::auction_max_weight_bipartite_matching(g2x::execution::par(4), graph, weights);
+		EXPECT_TRUE(g2x::algo::is_edge_set_matching(graph, parallel));
+		EXPECT_EQ(matching_weight(graph, parallel, weights), matching_weight(graph, sequential, weights));
+	}
+
+	TEST(bip_matchings, konig_vertex_cover_is_minimum) {
+		for(double average_degree: {1.5, 3.0, 8.0}) {
+			auto graph = random_bipartite_graph(5000, average_degree, 326);
+			auto cover = g2x::algo::min_bipartite_vertex_cover(graph);
+
+			for(const auto& [u, v, i]: g2x::all_edges(graph)) {
+				EXPECT_TRUE(cover[u] || cover[v]) << "edge (" << u << ", " << v << ") is not covered";
+			}
+			int cover_size = 0;
+			for(const auto& v: g2x::all_vertices(graph)) {
+				cover_size += bool(cover[v]);
+			}
+			EXPECT_EQ(cover_size, matching_size(graph, g2x::algo::max_bipartite_matching(graph))) << "average degree " << average_degree;
+		}
+	}
+
+	void expect_cycle_cover(const auto& graph, const auto& cover) {
+		auto out_count = g2x::create_vertex_property<int>(graph, 0);
+		auto in_count = g2x::create_vertex_property<int>(graph, 0);
+		for(const auto& [u, v, i]: g2x::all_edges(graph)) {
+			if(cover.at(i)) {
+				++out_count[u];
+				++in_count[v];
+			}
+		}
+		for(const auto& v: g2x::all_vertices(graph)) {
+			EXPECT_EQ(out_count.at(v), 1) << "vertex " << v;
+			EXPECT_EQ(in_count.at(v), 1) << "vertex " << v;
+		}
+	}
+
+	TEST(bip_matchings, cycle_cover_of_digraph) {
+		std::mt19937_64 rng(327);
+		int n = 3000;
+		std::vector<int> permutation(n);
+		std::ranges::iota(permutation, 0);
+		std::ranges::shuffle(permutation, rng);
+
+		std::vector<std::pair<int, int>> edges;
+		for(int v=0; v<n; v++) {
+			edges.emplace_back(v, permutation[v]);
+		}
+		for(int k=0; k<3*n; k++) {
+			edges.emplace_back(std::uniform_int_distribution(0, n-1)(rng), std::uniform_int_distribution(0, n-1)(rng));
+		}
+		std::ranges::shuffle(edges, rng);
+
+		auto graph = g2x::create_graph<g2x::basic_digraph>(n, edges);
+		auto cover = g2x::algo::cycle_cover(graph);
+		ASSERT_TRUE(cover.has_value());
+		expect_cycle_cover(graph, *cover);
+
+		auto dynamic_graph = g2x::create_graph<g2x::dynamic_digraph>(edges);
+		auto dynamic_cover = g2x::algo::cycle_cover(dynamic_graph);
+		ASSERT_TRUE(dynamic_cover.has_value());
+		expect_cycle_cover(dynamic_graph, *dynamic_cover);
+
+		// a vertex without incoming edges cannot be covered
+		edges.erase(std::remove_if(edges.begin(), edges.end(), [](const auto& e) {return e.second == 0;}), edges.end());
+		EXPECT_FALSE(g2x::algo::cycle_cover(g2x::create_graph<g2x::basic_digraph>(n, edges)).has_value());
+	}
+
+}
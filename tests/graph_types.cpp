@@ -7,6 +7,12 @@ namespace {
 	using all_graph_type_test_subjects = testing::Types<
 		g2x::basic_graph,
 		g2x::basic_digraph,
+		g2x::soa_basic_graph,
+		g2x::soa_basic_digraph,
+		g2x::compressed_graph,
+		g2x::compressed_digraph,
+		g2x::compressed_simple_graph,
+		g2x::compressed_simple_digraph,
 		g2x::dense_graph,
 		g2x::dense_digraph,
 		g2x::compact_dense_graph,
@@ -122,6 +128,22 @@ namespace {
 	}
 
 
+	TYPED_TEST(graph_types, outgoing_edges_uv_sorted) {
+		if constexpr (g2x::graph_traits::outgoing_edges_uv_sorted_v<TypeParam>) {
+			auto graph = g2x::create_graph<TypeParam>(edge_list{
+				{3,1}, {0,4}, {2,0},
+				{1,2}, {0,1}, {2,4}
+			});
+			for(const auto& vtx: g2x::all_vertices(graph)) {
+				auto targets = g2x::adjacent_vertices(graph, vtx) | std::ranges::to<std::vector>();
+				EXPECT_TRUE(std::ranges::is_sorted(targets));
+			}
+		} else {
+			GTEST_SKIP();
+		}
+	}
+
+
 	TYPED_TEST(graph_types, outgoing_edges_multiple) {
 		if constexpr (g2x::graph_traits::allows_multiple_edges_v<TypeParam>) {
 			auto graph = g2x::create_graph<TypeParam>(edge_list{
@@ -350,4 +372,56 @@ namespace {
 			GTEST_SKIP();
 		}
 	}
-}
\ No newline at end of file
+
+	TEST(basic_graph, parallel_construction_matches_sequential) {
+		std::mt19937_64 rng(311);
+		auto edges = g2x::graph_gen::edge_cardinality_generator(20000, 300000, true, rng) | std::ranges::to<std::vector>();
+
+		auto seq_graph = g2x::create_graph<g2x::basic_graph>(g2x::execution::seq, 20000, edges);
+		auto par_graph = g2x::create_graph<g2x::basic_graph>(g2x::execution::par(4), 20000, edges);
+
+		ASSERT_EQ(g2x::num_vertices(seq_graph), g2x::num_vertices(par_graph));
+		ASSERT_EQ(g2x::num_edges(seq_graph), g2x::num_edges(par_graph));
+		for(const auto& v: g2x::all_vertices(seq_graph)) {
+			EXPECT_TRUE(std::ranges::equal(g2x::outgoing_edges(seq_graph, v), g2x::outgoing_edges(par_graph, v), [](auto&& e1, auto&& e2) {
+				return e1.u == e2.u && e1.v == e2.v && e1.i == e2.i;
+			}));
+		}
+		for(int i=0; i<g2x::num_edges(seq_graph); i++) {
+			EXPECT_EQ(g2x::edge_at(seq_graph, i), g2x::edge_at(par_graph, i));
+		}
+	}
+
+	TEST(compressed_graph, matches_basic_graph) {
+		std::mt19937_64 rng(311);
+		// enough half-edges for the encoding to be split between threads
+		auto edges = g2x::graph_gen::edge_cardinality_generator(20000, 300000, true, rng) | std::ranges::to<std::vector>();
+
+		auto basic = g2x::create_graph<g2x::basic_graph>(20000, edges);
+		auto compressed = g2x::create_graph<g2x::compressed_graph>(g2x::execution::par(4), 20000, edges);
+
+		ASSERT_EQ(g2x::num_edges(basic), g2x::num_edges(compressed));
+		for(const auto& v: g2x::all_vertices(basic)) {
+			EXPECT_TRUE(std::ranges::equal(g2x::outgoing_edges(basic, v), g2x::outgoing_edges(compressed, v), [](auto&& e1, auto&& e2) {
+				return e1.u == e2.u && e1.v == e2.v && e1.i == e2.i;
+			}));
+		}
+		for(int i=0; i<g2x::num_edges(basic); i++) {
+			EXPECT_EQ(g2x::edge_at(basic, i), g2x::edge_at(compressed, i));
+		}
+	}
+
+	TEST(compact_dense_graph, degree_and_common_neighbors) {
+		std::vector<std::pair<int, int>> edges;
+		for(int v=1; v<150; v+=2) {
+			edges.emplace_back(0, v);
+			edges.emplace_back(1, v);
+		}
+		edges.emplace_back(0, 0);
+		auto graph = g2x::create_graph<g2x::compact_dense_graph>(150, edges);
+
+		EXPECT_EQ(g2x::degree(graph, 0), 77);
+		EXPECT_EQ(graph.num_common_neighbors(0, 1), 76);
+		EXPECT_EQ(graph.adjacency_matrix().words_per_row() % 8, 0);
+	}
+}
@@ -0,0 +1,104 @@
+#include "tests_common.hpp"
+
+#include <random>
+
+namespace {
+
+	auto random_view_test_edges(int num_vertices, int num_edges, std::uint64_t seed) {
+		std::mt19937_64 rng(seed);
+		return g2x::graph_gen::edge_cardinality_generator(num_vertices, num_edges, false, rng) | std::ranges::to<std::vector>();
+	}
+
+	void expect_same_distances(const auto& graph, const auto& tree, const auto& reference) {
+		for(const auto& v: g2x::all_vertices(graph)) {
+			EXPECT_EQ(tree.distances.at(v), reference.distances.at(v)) << "vertex " << v;
+		}
+	}
+
+	TEST(graph_views, transposed_graph_reverses_edges) {
+		int n = 2000;
+		auto edges = random_view_test_edges(n, 10000, 401);
+		auto reversed_edges = edges
+			| std::views::transform([](const auto& e) {return std::pair{e.second, e.first};})
+			| std::ranges::to<std::vector>();
+		auto reference = g2x::create_graph<g2x::basic_digraph>(n, reversed_edges);
+
+		auto graph = g2x::create_graph<g2x::basic_digraph>(n, edges);
+		g2x::transposed_graph view(graph);
+		EXPECT_EQ(g2x::num_edges(view), g2x::num_edges(graph));
+		for(const auto& [u, v, i]: g2x::all_edges(view)) {
+			EXPECT_TRUE(g2x::is_adjacent(graph, v, u));
+			EXPECT_EQ(g2x::edge_at(view, i), (g2x::edge_t<decltype(view)>{u, v, i}));
+		}
+		expect_same_distances(view, g2x::algo::bfs_tree(view, 0), g2x::algo::bfs_tree(reference, 0));
+
+		// lists incoming edges, so nothing is indexed
+		auto dynamic_graph = g2x::create_graph<g2x::dynamic_digraph>(edges);
+		auto dynamic_reference = g2x::create_graph<g2x::dynamic_digraph>(reversed_edges);
+		g2x::transposed_graph dynamic_view(dynamic_graph);
+		auto start = edges.front().first;
+		expect_same_distances(dynamic_view, g2x::algo::bfs_tree(dynamic_view, start), g2x::algo::bfs_tree(dynamic_reference, start));
+	}
+
+	TEST(graph_views, induced_subgraph_keeps_masked_vertices) {
+		int n = 3000;
+		auto edges = random_view_test_edges(n, 12000, 402);
+		auto graph = g2x::create_graph<g2x::basic_graph>(n, edges);
+
+		auto mask = g2x::create_vertex_property<g2x::boolean>(graph, false);
+		for(int v=0; v<n; v+=3) {
+			mask[v] = true;
+		}
+		auto kept_edges = edges
+			| std::views::filter([&](const auto& e) {return mask[e.first] && mask[e.second];})
+			| std::ranges::to<std::vector>();
+		auto reference = g2x::create_graph<g2x::basic_graph>(n, kept_edges);
+
+		g2x::induced_subgraph view(graph, mask);
+		EXPECT_EQ(g2x::num_vertices(view), (n + 2) / 3);
+		EXPECT_EQ(g2x::num_edges(view), std::ssize(kept_edges));
+		EXPECT_FALSE(g2x::is_adjacent(view, 0, 1));
+		expect_same_distances(view, g2x::algo::bfs_tree(view, 0), g2x::algo::bfs_tree(reference, 0));
+	}
+
+	TEST(graph_views, edge_filtered_graph_skips_edges) {
+		int n = 3000;
+		auto edges = random_view_test_edges(n, 12000, 403);
+		auto graph = g2x::create_graph<g2x::basic_graph>(n, edges);
+
+		std::vector<std::pair<int, int>> kept_edges;
+		for(int i=0; i<std::ssize(edges); i+=2) {
+			kept_edges.push_back(edges[i]);
+		}
+		auto reference = g2x::create_graph<g2x::basic_graph>(n, kept_edges);
+
+		g2x::edge_filtered_graph view(graph, [](const auto& e) {return e.i % 2 == 0;});
+		EXPECT_EQ(g2x::num_edges(view), std::ssize(kept_edges));
+		expect_same_distances(view, g2x::algo::bfs_tree(view, 0), g2x::algo::bfs_tree(reference, 0));
+	}
+
+	TEST(graph_views, double_cover_of_undirected_graph) {
+		int n = 1000;
+		auto edges = random_view_test_edges(n, 4000, 404);
+		edges.emplace_back(5, 5);
+		auto graph = g2x::create_graph<g2x::basic_graph>(n, edges);
+
+		g2x::bipartite_double_cover view(graph);
+		EXPECT_EQ(g2x::num_vertices(view), 2 * n);
+		EXPECT_EQ(g2x::num_edges(view), 2 * std::ssize(edges) - 1);
+
+		auto seen = g2x::create_edge_property<int>(view, 0);
+		for(const auto& e: g2x::all_edges(view)) {
+			const auto& [x, y, i] = e;
+			EXPECT_NE(view.is_in_vertex(x), view.is_in_vertex(y));
+			EXPECT_EQ(g2x::edge_at(view, i), e);
+			EXPECT_TRUE(g2x::is_adjacent(view, y, x));
+			++seen[i];
+
+			const auto& [u, v, base_i] = view.base_edge(e);
+			EXPECT_EQ(g2x::edge_at(graph, base_i), (g2x::edge_t<decltype(graph)>{u, v, base_i}));
+		}
+		EXPECT_EQ(std::ranges::count(seen, 1), g2x::num_edges(view));
+	}
+
+}
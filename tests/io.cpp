@@ -0,0 +1,155 @@
+#include "tests_common.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <set>
+
+namespace {
+
+	std::filesystem::path temp_graph_path(const char* name) {
+		return std::filesystem::temp_directory_path() / std::format("g2x_test_{}.bin", name);
+	}
+
+	TEST(mapped_basic_graph, round_trip) {
+		std::mt19937_64 rng(311);
+		auto edges = g2x::graph_gen::edge_cardinality_generator(500, 4000, true, rng) | std::ranges::to<std::vector>();
+		auto graph = g2x::create_graph<g2x::basic_graph>(500, edges);
+
+		auto path = temp_graph_path("round_trip");
+		g2x::write_mapped_graph(graph, path);
+		{
+			g2x::mapped_basic_graph mapped(path);
+			EXPECT_NO_THROW(mapped.validate());
+
+			ASSERT_EQ(g2x::num_vertices(graph), g2x::num_vertices(mapped));
+			ASSERT_EQ(g2x::num_edges(graph), g2x::num_edges(mapped));
+			for(const auto& v: g2x::all_vertices(graph)) {
+				EXPECT_TRUE(std::ranges::equal(g2x::outgoing_edges(graph, v), g2x::outgoing_edges(mapped, v)));
+			}
+			for(int i=0; i<g2x::num_edges(graph); i++) {
+				EXPECT_EQ(g2x::edge_at(graph, i), g2x::edge_at(mapped, i));
+			}
+		}
+		std::filesystem::remove(path);
+	}
+
+	TEST(mapped_basic_graph, rejects_type_mismatch) {
+		auto graph = g2x::create_graph<g2x::basic_graph>(std::vector<std::pair<int, int>>{{0, 1}, {1, 2}});
+
+		auto path = temp_graph_path("type_mismatch");
+		g2x::write_mapped_graph(graph, path);
+		EXPECT_THROW(g2x::mapped_basic_digraph{path}, std::runtime_error);
+		std::filesystem::remove(path);
+	}
+
+	TEST(mapped_basic_graph, rejects_corrupt_adjacency_regions) {
+		auto graph = g2x::create_graph<g2x::basic_graph>(std::vector<std::pair<int, int>>{{0, 1}, {1, 2}, {2, 3}});
+
+		auto path = temp_graph_path("corrupt_regions");
+		g2x::write_mapped_graph(graph, path);
+		g2x::detail::mapped_graph_header header;
+		std::ifstream(path, std::ios::binary).read(reinterpret_cast<char*>(&header), sizeof(header));
+		{
+			// points the region of vertex 1 past the end of the edge storage
+			std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+			int bad_offset = 1000;
+			file.seekp(header.adjacency_regions_offset + sizeof(int));
+			file.write(reinterpret_cast<const char*>(&bad_offset), sizeof(bad_offset));
+		}
+		// opening only checks the header and the array bounds
+		g2x::mapped_basic_graph mapped(path);
+		EXPECT_THROW(mapped.validate(), std::runtime_error);
+		std::filesystem::remove(path);
+	}
+
+
+	std::filesystem::path write_temp_file(const char* name, std::string_view contents) {
+		auto path = std::filesystem::temp_directory_path() / name;
+		std::ofstream(path, std::ios::binary) << contents;
+		return path;
+	}
+
+	std::multiset<std::pair<int, int>> edge_multiset(const auto& graph) {
+		std::multiset<std::pair<int, int>> result;
+		for(const auto& [u, v, i]: g2x::all_edges(graph)) {
+			result.emplace(u, v);
+		}
+		return result;
+	}
+
+	TEST(edge_list, plain) {
+		auto path = write_temp_file("g2x_test_plain.txt", "# comment\n0 1\n1 2 0.5\n\n3 0\n");
+		auto graph = g2x::io::read_graph<g2x::basic_digraph>(path, g2x::io::edge_list_format::plain);
+		EXPECT_EQ(g2x::num_vertices(graph), 4);
+		EXPECT_EQ(edge_multiset(graph), (std::multiset<std::pair<int, int>>{{0, 1}, {1, 2}, {3, 0}}));
+		std::filesystem::remove(path);
+	}
+
+	TEST(edge_list, csv_with_header) {
+		auto path = write_temp_file("g2x_test.csv", "source,target\n0,1\n2, 1\n");
+		auto graph = g2x::io::read_graph<g2x::basic_digraph>(path);
+		EXPECT_EQ(edge_multiset(graph), (std::multiset<std::pair<int, int>>{{0, 1}, {2, 1}}));
+		std::filesystem::remove(path);
+	}
+
+	TEST(edge_list, dimacs) {
+		auto path = write_temp_file("g2x_test.dimacs", "c comment\np edge 5 2\ne 1 2\ne 4 3\n");
+		auto graph = g2x::io::read_graph<g2x::basic_digraph>(path);
+		EXPECT_EQ(g2x::num_vertices(graph), 5);
+		EXPECT_EQ(edge_multiset(graph), (std::multiset<std::pair<int, int>>{{0, 1}, {3, 2}}));
+		std::filesystem::remove(path);
+	}
+
+	TEST(edge_list, dimacs_max_flow_skips_node_lines) {
+		auto path = write_temp_file("g2x_test.max", "c max-flow\np max 4 3\nn 1 s\nn 4 t\na 1 2 5\na 2 4 3\na 1 3 1\n");
+		auto graph = g2x::io::read_graph<g2x::basic_digraph>(path);
+		EXPECT_EQ(g2x::num_vertices(graph), 4);
+		EXPECT_EQ(edge_multiset(graph), (std::multiset<std::pair<int, int>>{{0, 1}, {1, 3}, {0, 2}}));
+		std::filesystem::remove(path);
+	}
+
+	TEST(edge_list, stats_count_edges_once) {
+		// dense graphs need the number of vertices, so the edges are read before construction
+		auto path = write_temp_file("g2x_test_stats.txt", "0 1\n1 2\n2 3\n");
+		g2x::io::read_stats stats;
+		auto graph = g2x::io::read_graph<g2x::dense_graph>(path, g2x::io::edge_list_format::plain, &stats);
+		EXPECT_EQ(stats.num_edges, 3);
+		EXPECT_EQ(g2x::num_vertices(graph), 4);
+		EXPECT_TRUE(g2x::is_adjacent(graph, 2, 3));
+		std::filesystem::remove(path);
+	}
+
+	TEST(edge_list, matrix_market_is_bipartite) {
+		auto path = write_temp_file("g2x_test.mtx", "%%MatrixMarket matrix coordinate real general\n% comment\n2 3 3\n1 1 1.0\n1 3 2.0\n2 2 -1.0\n");
+		auto graph = g2x::io::read_graph<g2x::basic_digraph>(path);
+		EXPECT_EQ(g2x::num_vertices(graph), 5);
+		EXPECT_EQ(edge_multiset(graph), (std::multiset<std::pair<int, int>>{{0, 2}, {0, 4}, {1, 3}}));
+		std::filesystem::remove(path);
+	}
+
+	TEST(edge_list, parallel_matches_sequential) {
+		std::mt19937_64 rng(311);
+		std::string contents;
+		for(const auto& [u, v]: g2x::graph_gen::edge_cardinality_generator(5000, 600000, true, rng)) {
+			contents += std::format("{} {}\n", u, v);
+		}
+		// large enough to be parsed in several chunks
+		ASSERT_GT(contents.size(), 4u << 20);
+		auto path = write_temp_file("g2x_test_parallel.txt", contents);
+
+		g2x::io::read_stats seq_stats;
+		g2x::io::read_stats par_stats;
+		auto seq_graph = g2x::io::read_graph<g2x::basic_graph>(path, g2x::io::edge_list_format::plain, &seq_stats);
+		auto par_graph = g2x::io::read_graph<g2x::basic_graph>(path, g2x::io::edge_list_format::plain, g2x::execution::par(4), &par_stats);
+
+		EXPECT_EQ(seq_stats.num_edges, 600000);
+		EXPECT_EQ(par_stats.num_edges, 600000);
+		EXPECT_EQ(par_stats.num_bytes, contents.size());
+		ASSERT_EQ(g2x::num_edges(seq_graph), g2x::num_edges(par_graph));
+		for(int i=0; i<g2x::num_edges(seq_graph); i++) {
+			EXPECT_EQ(g2x::edge_at(seq_graph, i), g2x::edge_at(par_graph, i));
+		}
+		std::filesystem::remove(path);
+	}
+}
@@ -0,0 +1,111 @@
+#include "tests_common.hpp"
+
+#include <atomic>
+#include <random>
+
+namespace {
+
+	/*
+	 * Checks that a search tree has the same distances as the reference one, and that every
+	 * source edge leads from a vertex one level closer to the source.
+	 */
+	template<typename GraphT>
+	void expect_equivalent_bfs_tree(const GraphT& graph, const auto& tree, const auto& reference) {
+		for(const auto& v: g2x::all_vertices(graph)) {
+			ASSERT_EQ(tree.distances.at(v), reference.distances.at(v)) << "vertex " << v;
+			if(tree.distances.at(v) > 0) {
+				ASSERT_TRUE(tree.source_edges.at(v).has_value());
+				const auto& e = *tree.source_edges.at(v);
+				EXPECT_EQ(e.v, v);
+				EXPECT_EQ(tree.distances.at(e.u) + 1, tree.distances.at(v));
+				EXPECT_TRUE(g2x::is_adjacent(graph, e.u, e.v));
+			} else {
+				EXPECT_FALSE(tree.source_edges.at(v).has_value());
+			}
+		}
+	}
+
+	template<typename GraphT>
+	GraphT random_graph(int num_vertices, int num_edges, std::uint64_t seed) {
+		std::mt19937_64 rng(seed);
+		auto edges = g2x::graph_gen::edge_cardinality_generator(num_vertices, num_edges, false, rng) | std::ranges::to<std::vector>();
+		return g2x::create_graph<GraphT>(num_vertices, edges);
+	}
+
+	TEST(graph_search, reset_search_matches_fresh_search) {
+		auto graph = random_graph<g2x::basic_graph>(3000, 6000, 317);
+		g2x::algo::breadth_first_search bfs(graph);
+
+		for(int start: {0, 1, 2, 3}) {
+			// leaves marked and visited vertices behind for the reset
+			bfs.reset();
+			bfs.add_vertex(start + 100);
+			for(int k=0; k<50 && bfs.next_vertex(); k++) {}
+
+			bfs.reset();
+			bfs.add_vertex(start);
+			auto distances = g2x::create_vertex_property<int>(graph, -1);
+			while(auto v = bfs.next_vertex()) {
+				bfs.update_distances(*v, distances);
+			}
+			auto reference = g2x::algo::bfs_tree(graph, start);
+			for(const auto& v: g2x::all_vertices(graph)) {
+				ASSERT_EQ(distances[v], reference.distances[v]) << "vertex " << v;
+				EXPECT_EQ(bfs.source_edge(v).has_value(), reference.source_edges[v].has_value()) << "vertex " << v;
+			}
+		}
+	}
+
+	TEST(dense_bfs, compact_dense_graph_matches_generic_bfs) {
+		auto graph = random_graph<g2x::compact_dense_graph>(700, 3000, 311);
+		expect_equivalent_bfs_tree(graph, g2x::algo::dense_bfs_tree(graph, 0), g2x::algo::bfs_tree(graph, 0));
+	}
+
+	TEST(dense_bfs, dense_digraph_matches_generic_bfs) {
+		auto graph = random_graph<g2x::dense_digraph>(500, 20000, 312);
+		expect_equivalent_bfs_tree(graph, g2x::algo::dense_bfs_tree(graph, 3), g2x::algo::bfs_tree(graph, 3));
+	}
+
+	TEST(dense_bfs, basic_graph_matches_generic_bfs) {
+		auto graph = random_graph<g2x::basic_graph>(300, 900, 313);
+		expect_equivalent_bfs_tree(graph, g2x::algo::dense_bfs_tree(graph, 0), g2x::algo::bfs_tree(graph, 0));
+	}
+
+	TEST(direction_optimizing_bfs, undirected_graph_matches_generic_bfs) {
+		auto graph = random_graph<g2x::basic_graph>(5000, 40000, 314);
+		auto reference = g2x::algo::bfs_tree(graph, 0);
+		expect_equivalent_bfs_tree(graph, g2x::algo::direction_optimizing_bfs_tree(graph, 0), reference);
+
+		// switches to bottom-up as soon as the frontier grows
+		expect_equivalent_bfs_tree(graph, g2x::algo::direction_optimizing_bfs_tree(graph, 0, {.alpha = 1e9, .beta = 1e9}), reference);
+	}
+
+	TEST(direction_optimizing_bfs, digraph_with_incoming_edges_matches_generic_bfs) {
+		auto graph = random_graph<g2x::dynamic_digraph>(2000, 30000, 315);
+		auto start = g2x::all_edges(graph).front().u;
+		expect_equivalent_bfs_tree(graph, g2x::algo::direction_optimizing_bfs_tree(graph, start), g2x::algo::bfs_tree(graph, start));
+	}
+
+	TEST(parallel_bfs, matches_generic_bfs) {
+		auto graph = random_graph<g2x::basic_graph>(100000, 400000, 316);
+		auto reference = g2x::algo::bfs_tree(graph, 0);
+		expect_equivalent_bfs_tree(graph, g2x::algo::parallel_bfs_tree(g2x::execution::par(4), graph, 0), reference);
+		expect_equivalent_bfs_tree(graph, g2x::algo::parallel_bfs_tree(g2x::execution::seq, graph, 0), reference);
+	}
+
+	TEST(parallel_bfs, rethrows_worker_exceptions) {
+		auto graph = random_graph<g2x::basic_graph>(100000, 400000, 318);
+		std::atomic<bool> armed = false;
+		// only throws once the view has counted its edges
+		g2x::edge_filtered_graph view(graph, [&](const auto& e) {
+			if(armed.load() && e.u % 1000 == 7) {
+				throw std::runtime_error("edge rejected");
+			}
+			return true;
+		});
+		armed = true;
+		// would deadlock if the other workers kept waiting for the throwing one at a barrier
+		EXPECT_THROW(g2x::algo::parallel_bfs_tree(g2x::execution::par(4), view, 0), std::runtime_error);
+	}
+
+}
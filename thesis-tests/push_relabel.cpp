@@ -0,0 +1,61 @@
+
+#include <fstream>
+
+#include "common.hpp"
+#include "graph2x_lab/graph2x_lab.hpp"
+
+
+struct test_push_relabel_vs_hk73 {
+
+	int num_partition_vertices;
+
+	struct x_axis {
+		double avg_deg;
+	};
+
+	struct y_axis {
+		double us_time_hopcroft_karp;
+		double us_time_push_relabel;
+	};
+
+	y_axis eval(const x_axis& x, auto&& rng) const {
+		auto edges = g2x::graph_gen::average_degree_bipartite_generator(
+			num_partition_vertices, num_partition_vertices, x.avg_deg, rng);
+		auto graph = g2x::create_graph<g2x::basic_graph>(edges);
+		g2x::lab::stopwatch sw;
+		y_axis result;
+		volatile int sink = 0;
+
+		sw = {};
+		auto match1 = g2x::algo::max_bipartite_matching(graph);
+		sink += match1.size();
+		result.us_time_hopcroft_karp = sw.peek() * 1000000.0;
+
+		sw = {};
+		auto match2 = g2x::algo::push_relabel_max_bipartite_matching(graph);
+		sink += match2.size();
+		result.us_time_push_relabel = sw.peek() * 1000000.0;
+
+		return result;
+	}
+
+};
+
+
+int main() {
+
+	for(int num_vtx: {1000, 10000}) {
+		g2x::lab::execute_test<test_push_relabel_vs_hk73>({
+			.short_title = std::format("push-relabel-vs-hk73_v-{}", num_vtx*2),
+			.title = std::format("Czas push-relabel i H-K w zależności od średniego stopnia $G$ ($|V| = {}*2$)", num_vtx),
+			.samples_per_point = 20,
+			.test_instance = {
+				.num_partition_vertices = num_vtx
+			},
+			.x_axis = g2x::lab::linspace(1.0, 6.0, 50),
+			.save_to_csv = true,
+			.save_to_pgfplots = true
+		});
+	}
+
+}